@@ -1,7 +1,8 @@
 import * as roles from '@electron/internal/browser/api/menu-item-roles';
-import { Menu, BaseWindow, WebContents, KeyboardEvent } from 'electron/main';
+import { Menu, BaseWindow, WebContents, KeyboardEvent, NativeImage } from 'electron/main';
 
 let nextCommandId = 0;
+const icons = new WeakMap<Electron.MenuItem, NativeImage | string | null>();
 
 const MenuItem = function (this: any, options: any) {
   // Preserve extra fields specified by user
@@ -25,7 +26,6 @@ const MenuItem = function (this: any, options: any) {
   this.overrideReadOnlyProperty('type', roles.getDefaultType(this.role));
   this.overrideReadOnlyProperty('role');
   this.overrideReadOnlyProperty('accelerator');
-  this.overrideReadOnlyProperty('icon');
   this.overrideReadOnlyProperty('submenu');
 
   this.overrideProperty('label', roles.getDefaultLabel(this.role));
@@ -43,6 +43,14 @@ const MenuItem = function (this: any, options: any) {
 
   this.overrideReadOnlyProperty('commandId', ++nextCommandId);
 
+  // Read-only, but menu.updateMenuItem() can replace it.
+  this.overrideProperty('icon');
+  icons.set(this, this.icon);
+  Object.defineProperty(this, 'icon', {
+    enumerable: true,
+    get: () => icons.get(this)
+  });
+
   Object.defineProperty(this, 'userAccelerator', {
     get: () => {
       if (process.platform !== 'darwin') return null;
@@ -81,6 +89,10 @@ MenuItem.prototype.getCheckStatus = function () {
   return roles.getCheckStatus(this.role);
 };
 
+MenuItem.prototype._setIcon = function (icon: NativeImage | string) {
+  icons.set(this, icon);
+};
+
 MenuItem.prototype.overrideProperty = function (name: string, defaultValue: any = null) {
   if (this[name] == null) {
     this[name] = defaultValue;
@@ -119,6 +119,59 @@ Menu.prototype.getMenuItemById = function (id) {
   return found;
 };
 
+Menu.prototype.updateMenuItem = function (id, options) {
+  const item = id instanceof MenuItem ? id : this.getMenuItemById(id);
+  if (!item) {
+    throw new Error(`No menu item with id '${id}' in this menu`);
+  } else if (!item.menu) {
+    throw new Error('Menu item has not been added to a menu');
+  } else if (!containsMenu(this, item.menu)) {
+    throw new Error('Menu item is not in this menu or its submenus');
+  }
+  if (options == null || typeof options !== 'object') {
+    throw new TypeError('Options must be an object');
+  }
+
+  // Patch the native model of the menu that owns the item, the platform menus
+  // are then told about the changed items only instead of being rebuilt.
+  const { menu } = item;
+  const index = menu.getIndexOfCommandId(item.commandId);
+  const changed = new Set([item]);
+
+  if (options.label !== undefined) {
+    item.label = options.label;
+    menu.setLabel(index, options.label);
+  }
+  if (options.sublabel !== undefined) {
+    item.sublabel = options.sublabel;
+    menu.setSublabel(index, options.sublabel);
+  }
+  if (options.toolTip !== undefined) {
+    item.toolTip = options.toolTip;
+    menu.setToolTip(index, options.toolTip);
+  }
+  if (options.icon !== undefined) {
+    item._setIcon(options.icon);
+    menu.setIcon(index, options.icon);
+  }
+  if (options.enabled !== undefined) item.enabled = options.enabled;
+  if (options.visible !== undefined) item.visible = options.visible;
+  if (options.checked !== undefined) {
+    if (item.type === 'radio' && !options.checked) {
+      throw new TypeError('A radio item cannot be unchecked, check another item of its group instead');
+    }
+    item.checked = options.checked;
+    // Checking a radio item unchecks the others in its group.
+    if (item.type === 'radio') {
+      for (const other of menu.groupsMap[item.groupId]) changed.add(other);
+    }
+  }
+
+  for (const changedItem of changed) {
+    menu._itemChangedAt(menu.getIndexOfCommandId(changedItem.commandId));
+  }
+};
+
 Menu.prototype.append = function (item) {
   return this.insert(this.getItemCount(), item);
 };
@@ -217,6 +270,11 @@ function areValidTemplateItems (template: (MenuItemConstructorOptions | MenuItem
     (Object.hasOwn(item, 'label') || Object.hasOwn(item, 'role') || item.type === 'separator'));
 }
 
+// Whether |menu| is |root| or one of its submenus, at any depth
+function containsMenu (root: MenuType, menu: MenuType): boolean {
+  return root === menu || root.items.some(item => item.submenu != null && containsMenu(item.submenu, menu));
+}
+
 function sortTemplate (template: (MenuItemConstructorOptions | MenuItem)[]) {
   const sorted = sortMenuItems(template);
   for (const item of sorted) {
@@ -279,7 +337,9 @@ function insertItemByType (this: MenuType, item: MenuItem, pos: number) {
       Object.defineProperty(item, 'checked', {
         enumerable: true,
         get: () => checked.get(item),
-        set: () => {
+        set: (value: boolean) => {
+          // A group always has a checked item, so unchecking one is ignored.
+          if (!value) return;
           for (const other of this.groupsMap[item.groupId]) {
             if (other !== item) checked.set(other, false);
           }
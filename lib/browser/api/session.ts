@@ -1,11 +1,34 @@
 import { fetchWithSession } from '@electron/internal/browser/api/net-fetch';
-import { net } from 'electron/main';
+import { net, webContents } from 'electron/main';
 const { fromPartition, fromPath, Session } = process._linkedBinding('electron_browser_session');
 
 Session.prototype.fetch = function (input: RequestInfo, init?: RequestInit) {
   return fetchWithSession(input, init, this, net.request);
 };
 
+Session.prototype.warmCodeCache = async function (urls: string[], options: Electron.WarmCodeCacheOptions = {}) {
+  if (!Array.isArray(urls) || urls.some(url => typeof url !== 'string')) {
+    throw new TypeError('urls must be an array of strings');
+  }
+  // Blink only produces code cache for scripts it has compiled and run in a
+  // renderer, keyed by the site of the page that loaded them, so the pages
+  // themselves have to be loaded. Skipping the heat check makes the first
+  // load produce the cache, and eager compilation makes it cover every
+  // function rather than only those that ran while loading.
+  for (const url of urls) {
+    const contents = (webContents as typeof ElectronInternal.WebContents).create({
+      ...options.webPreferences,
+      session: this,
+      v8CacheOptions: 'bypassHeatCheckAndEagerCompile'
+    });
+    try {
+      await contents.loadURL(url);
+    } finally {
+      contents.destroy();
+    }
+  }
+};
+
 export default {
   fromPartition,
   fromPath,
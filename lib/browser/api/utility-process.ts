@@ -1,6 +1,8 @@
 import { EventEmitter } from 'events';
 import { Duplex, PassThrough } from 'stream';
 import { Socket } from 'net';
+import * as os from 'os';
+import { MessageChannelMain } from 'electron/main';
 import { MessagePortMain } from '@electron/internal/browser/message-port-main';
 const { _fork } = process._linkedBinding('electron_browser_utility_process');
 
@@ -50,6 +52,13 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       }
     }
 
+    for (const key of ['maxOldGenerationSizeMb', 'maxRssMb', 'resourceUsageInterval'] as const) {
+      const value = options[key];
+      if (value != null && (!Number.isInteger(value) || value <= 0)) {
+        throw new TypeError(`${key} must be a positive integer.`);
+      }
+    }
+
     if (typeof options.stdio === 'string') {
       const stdio : Array<'pipe' | 'ignore' | 'inherit'> = [];
       switch (options.stdio) {
@@ -148,3 +157,245 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
 export function fork (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
   return new ForkUtilityProcess(modulePath, args, options);
 }
+
+interface PoolJob {
+  message: any;
+  transfer: Electron.MessagePortMain[];
+  queuedAt: number;
+  startedAt: number;
+  resolve: (result: any) => void;
+  reject: (error: Error) => void;
+}
+
+interface PoolWorker {
+  child: ForkUtilityProcess;
+  spawned: boolean;
+  jobs: Set<PoolJob>;
+  idleTimer: NodeJS.Timeout | null;
+}
+
+function checkInteger (name: string, value: number, min: number) {
+  if (!Number.isInteger(value) || value < min) {
+    throw new TypeError(`${name} must be an integer greater than or equal to ${min}.`);
+  }
+}
+
+class UtilityProcessPool implements Electron.UtilityProcessPool {
+  #modulePath: string;
+  #args: string[];
+  #forkOptions: Electron.ForkOptions;
+  #minSize: number;
+  #maxSize: number;
+  #idleTimeout: number;
+  #concurrency: number;
+  #workers = new Set<PoolWorker>();
+  #queue: PoolJob[] = [];
+  #closed = false;
+  #completedJobs = 0;
+  #failedJobs = 0;
+  #totalQueueTime = 0;
+  #totalRunTime = 0;
+
+  constructor (modulePath: string, args: string[], options: Electron.CreatePoolOptions) {
+    if (!modulePath) {
+      throw new Error('Missing UtilityProcess entry script.');
+    }
+
+    this.#modulePath = modulePath;
+    this.#args = args;
+    this.#forkOptions = options.forkOptions ?? {};
+    this.#minSize = options.minSize ?? 1;
+    this.#maxSize = options.maxSize ?? Math.max(this.#minSize, os.availableParallelism());
+    this.#idleTimeout = options.idleTimeout ?? 30000;
+    this.#concurrency = options.concurrency ?? 1;
+
+    checkInteger('minSize', this.#minSize, 0);
+    checkInteger('maxSize', this.#maxSize, Math.max(this.#minSize, 1));
+    checkInteger('idleTimeout', this.#idleTimeout, 0);
+    checkInteger('concurrency', this.#concurrency, 1);
+
+    this.#replenish();
+  }
+
+  run (message: any, transfer: Electron.MessagePortMain[] = []): Promise<any> {
+    if (this.#closed) {
+      return Promise.reject(new Error('The pool has been closed.'));
+    }
+    return new Promise((resolve, reject) => {
+      this.#queue.push({ message, transfer, queuedAt: performance.now(), startedAt: 0, resolve, reject });
+      this.#dispatch();
+    });
+  }
+
+  getMetrics (): Electron.UtilityProcessPoolMetrics {
+    let activeJobs = 0;
+    let idleWorkers = 0;
+    for (const worker of this.#workers) {
+      activeJobs += worker.jobs.size;
+      if (worker.jobs.size === 0) idleWorkers++;
+    }
+    const finishedJobs = this.#completedJobs + this.#failedJobs;
+    return {
+      workers: this.#workers.size,
+      idleWorkers,
+      queuedJobs: this.#queue.length,
+      activeJobs,
+      completedJobs: this.#completedJobs,
+      failedJobs: this.#failedJobs,
+      averageQueueTime: finishedJobs ? this.#totalQueueTime / finishedJobs : 0,
+      averageRunTime: finishedJobs ? this.#totalRunTime / finishedJobs : 0
+    };
+  }
+
+  close () {
+    if (this.#closed) return;
+    this.#closed = true;
+    for (const job of this.#queue.splice(0)) {
+      job.reject(new Error('The pool has been closed.'));
+    }
+    for (const worker of [...this.#workers]) {
+      this.#retire(worker);
+    }
+  }
+
+  #spawnWorker () {
+    const child = new ForkUtilityProcess(this.#modulePath, this.#args, this.#forkOptions);
+    const worker: PoolWorker = { child, spawned: false, jobs: new Set(), idleTimer: null };
+    this.#workers.add(worker);
+    child.once('spawn', () => {
+      worker.spawned = true;
+      this.#dispatch();
+    });
+    child.once('exit', (code: number) => {
+      const wasLive = this.#workers.delete(worker);
+      if (worker.idleTimer) clearTimeout(worker.idleTimer);
+      for (const job of worker.jobs) {
+        this.#finish(job, false);
+        job.reject(new Error(`Utility process exited with code ${code} before replying.`));
+      }
+      worker.jobs.clear();
+      if (!wasLive || this.#closed) return;
+      if (worker.spawned) {
+        this.#replenish();
+        this.#dispatch();
+      } else if (this.#workers.size === 0) {
+        // The entry script cannot be launched, so do not keep retrying.
+        for (const job of this.#queue.splice(0)) {
+          job.reject(new Error(`Utility process failed to start (exit code ${code}).`));
+        }
+      }
+    });
+    return worker;
+  }
+
+  #retire (worker: PoolWorker) {
+    this.#workers.delete(worker);
+    if (worker.idleTimer) clearTimeout(worker.idleTimer);
+    worker.child.kill();
+  }
+
+  #replenish () {
+    while (this.#workers.size < this.#minSize) {
+      this.#spawnWorker();
+    }
+  }
+
+  // Least loaded worker with a free slot, preferring those that are already
+  // running over those still starting up.
+  #pickWorker (): PoolWorker | null {
+    let best: PoolWorker | null = null;
+    for (const worker of this.#workers) {
+      if (worker.jobs.size >= this.#concurrency) continue;
+      if (!best || worker.jobs.size < best.jobs.size ||
+          (worker.jobs.size === best.jobs.size && worker.spawned && !best.spawned)) {
+        best = worker;
+      }
+    }
+    return best;
+  }
+
+  #dispatch () {
+    while (this.#queue.length > 0) {
+      let worker = this.#pickWorker();
+      if (!worker) {
+        if (this.#workers.size >= this.#maxSize) return;
+        worker = this.#spawnWorker();
+      }
+      this.#start(worker, this.#queue.shift()!);
+    }
+  }
+
+  #start (worker: PoolWorker, job: PoolJob) {
+    if (worker.idleTimer) {
+      clearTimeout(worker.idleTimer);
+      worker.idleTimer = null;
+    }
+    worker.jobs.add(job);
+    job.startedAt = performance.now();
+
+    // Each job carries its own reply port, so that workers can answer out of
+    // order and the pool never needs to tag messages on the parent port.
+    const { port1, port2 } = new MessageChannelMain();
+    const settle = (reply: () => void) => {
+      if (!worker.jobs.delete(job)) return;
+      port1.removeAllListeners();
+      port1.close();
+      reply();
+      this.#onWorkerFree(worker);
+    };
+    port1.once('message', (event) => {
+      settle(() => {
+        this.#finish(job, true);
+        job.resolve(event.data);
+      });
+    });
+    port1.once('close', () => {
+      // The reply port also closes when the process dies, which can be seen
+      // before 'exit', so stop handing jobs to this worker.
+      if (worker.jobs.has(job) && this.#workers.has(worker)) {
+        this.#retire(worker);
+        if (!this.#closed) this.#replenish();
+      }
+      settle(() => {
+        this.#finish(job, false);
+        job.reject(new Error('The utility process closed the reply port without replying.'));
+      });
+    });
+    port1.start();
+    worker.child.postMessage(job.message, [port2, ...job.transfer] as MessagePortMain[]);
+  }
+
+  #finish (job: PoolJob, succeeded: boolean) {
+    const now = performance.now();
+    this.#totalQueueTime += job.startedAt - job.queuedAt;
+    this.#totalRunTime += now - job.startedAt;
+    if (succeeded) {
+      this.#completedJobs++;
+    } else {
+      this.#failedJobs++;
+    }
+  }
+
+  #onWorkerFree (worker: PoolWorker) {
+    this.#dispatch();
+    if (worker.jobs.size > 0 || !this.#workers.has(worker) ||
+        this.#workers.size <= this.#minSize) {
+      return;
+    }
+    worker.idleTimer = setTimeout(() => {
+      worker.idleTimer = null;
+      if (worker.jobs.size === 0 && this.#workers.size > this.#minSize) {
+        this.#retire(worker);
+      }
+    }, this.#idleTimeout);
+    worker.idleTimer.unref();
+  }
+}
+
+export function createPool (modulePath: string, args?: string[], options?: Electron.CreatePoolOptions) {
+  if (args != null && typeof args === 'object' && !Array.isArray(args)) {
+    options = args;
+    args = [];
+  }
+  return new UtilityProcessPool(modulePath, args ?? [], options ?? {});
+}
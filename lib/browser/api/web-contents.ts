@@ -18,6 +18,7 @@ import * as deprecate from '@electron/internal/common/deprecate';
 session;
 
 const webFrameMainBinding = process._linkedBinding('electron_browser_web_frame_main');
+const { Session } = process._linkedBinding('electron_browser_session');
 
 let nextId = 0;
 const getNextId = function () {
@@ -135,6 +136,10 @@ WebContents.prototype._sendInternal = function (channel, ...args) {
   return this.mainFrame._sendInternal(channel, ...args);
 };
 
+WebContents.prototype.grantChannel = function (channel, peer) {
+  return this.mainFrame.grantChannel(channel, peer instanceof WebContents ? peer.mainFrame : peer);
+};
+
 function getWebFrame (contents: Electron.WebContents, frame: number | [number, number]) {
   if (typeof frame === 'number') {
     return webFrameMain.fromId(contents.mainFrame.processId, frame);
@@ -604,17 +609,22 @@ WebContents.prototype._init = function () {
   });
 
   // Dispatch IPC messages to the ipc module.
-  this.on('-ipc-message' as any, function (this: Electron.WebContents, event: Electron.IpcMainEvent, internal: boolean, channel: string, args: any[]) {
+  this.on('-ipc-message' as any, function (this: Electron.WebContents, event: Electron.IpcMainEvent, internal: boolean, channel: string, message: Electron.SerializedMessage) {
     addSenderToEvent(event, this);
+    // The arguments are decoded at most once, and only if a listener that has
+    // not deferred deserialization of the channel needs them.
+    let args: any[] | undefined;
+    const getArgs = () => (args ??= message.deserialize());
     if (internal) {
-      ipcMainInternal.emit(channel, event, ...args);
+      ipcMainInternal.emit(channel, event, ...getArgs());
     } else {
       addReplyToEvent(event);
-      this.emit('ipc-message', event, channel, ...args);
+      if (this.listenerCount('ipc-message') > 0) this.emit('ipc-message', event, channel, ...getArgs());
       const maybeWebFrame = getWebFrameForEvent(event);
-      maybeWebFrame && maybeWebFrame.ipc.emit(channel, event, ...args);
-      ipc.emit(channel, event, ...args);
-      ipcMain.emit(channel, event, ...args);
+      for (const target of [maybeWebFrame?.ipc, ipc, ipcMain] as (IpcMainImpl | undefined)[]) {
+        if (!target || target.listenerCount(channel) === 0) continue;
+        target.emit(channel, event, ...(target._isDeferred(channel, message) ? [message] : getArgs()));
+      }
     }
   });
 
@@ -943,6 +953,43 @@ export function fromDevToolsTargetId (targetId: string) {
   return binding.fromDevToolsTargetId(targetId);
 }
 
+export function broadcast (targets: (Electron.WebContents | Electron.WebFrameMain)[] | Electron.Session, channel: string, ...args: any[]) {
+  if (typeof channel !== 'string') {
+    throw new TypeError('Missing required channel argument');
+  }
+
+  let contents: Electron.WebContents[];
+  const frames = new Set<Electron.WebFrameMain>();
+  if (Array.isArray(targets)) {
+    contents = [];
+    for (const target of targets) {
+      if (target instanceof webFrameMainBinding.WebFrameMain) {
+        frames.add(target);
+      } else {
+        contents.push(target);
+      }
+    }
+  } else if (targets instanceof Session) {
+    const all: Electron.WebContents[] = binding.getAllWebContents();
+    contents = all.filter(c => c.session === targets);
+  } else {
+    throw new TypeError('targets must be an array or a Session');
+  }
+  for (const c of contents) {
+    if (!c.isDestroyed()) frames.add(c.mainFrame);
+  }
+
+  // Encode the arguments once and forward the same message to every frame.
+  const message = webFrameMainBinding._serializeMessage(args);
+  for (const frame of frames) {
+    try {
+      frame._send(false /* internal */, channel, [message]);
+    } catch (e) {
+      console.error('Error broadcasting from webContents: ', e);
+    }
+  }
+}
+
 export function getFocusedWebContents () {
   let focused = null;
   for (const contents of binding.getAllWebContents()) {
@@ -3,6 +3,7 @@ import { IpcMainInvokeEvent } from 'electron/main';
 
 export class IpcMainImpl extends EventEmitter implements Electron.IpcMain {
   private _invokeHandlers: Map<string, (e: IpcMainInvokeEvent, ...args: any[]) => void> = new Map();
+  private _deferredChannels: Map<string, number> = new Map();
 
   constructor () {
     super();
@@ -31,4 +32,21 @@ export class IpcMainImpl extends EventEmitter implements Electron.IpcMain {
   removeHandler (method: string) {
     this._invokeHandlers.delete(method);
   }
+
+  deferDeserialization (channel: string, options?: { threshold?: number } | null) {
+    if (options === null) {
+      this._deferredChannels.delete(channel);
+      return;
+    }
+    const threshold = options?.threshold ?? 0;
+    if (!Number.isInteger(threshold) || threshold < 0) {
+      throw new TypeError('threshold must be a non-negative integer');
+    }
+    this._deferredChannels.set(channel, threshold);
+  }
+
+  _isDeferred (channel: string, message: Electron.SerializedMessage) {
+    const threshold = this._deferredChannels.get(channel);
+    return threshold !== undefined && message.byteLength >= threshold;
+  }
 }
@@ -25,4 +25,8 @@ export class MessagePortMain extends EventEmitter implements Electron.MessagePor
     }
     return this._internalPort.postMessage(...args);
   }
+
+  enableSharedMemoryTransport (options?: { bufferSize?: number }) {
+    return this._internalPort.enableSharedMemoryTransport(options);
+  }
 }
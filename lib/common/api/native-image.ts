@@ -1,3 +1,19 @@
 const { nativeImage } = process._linkedBinding('electron_common_native_image');
 
+// Each image is decoded by its own thread pool task, so the batch runs in
+// parallel without any extra work here.
+nativeImage.createFromPathsAsync = function (paths: string[]) {
+  if (!Array.isArray(paths)) {
+    return Promise.reject(new TypeError('paths must be an array of strings'));
+  }
+  return Promise.all(paths.map(path => nativeImage.createFromPathAsync(path)));
+};
+
+nativeImage.resizeAllAsync = function (images: Electron.NativeImage[], options: Parameters<Electron.NativeImage['resizeAsync']>[0]) {
+  if (!Array.isArray(images)) {
+    return Promise.reject(new TypeError('images must be an array of NativeImage'));
+  }
+  return Promise.all(images.map(image => image.resizeAsync(options)));
+};
+
 export default nativeImage;
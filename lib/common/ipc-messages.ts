@@ -19,6 +19,8 @@ export const enum IPC_MESSAGES {
   GUEST_VIEW_MANAGER_PROPERTY_SET = 'GUEST_VIEW_MANAGER_PROPERTY_SET',
 
   RENDERER_WEB_FRAME_METHOD = 'RENDERER_WEB_FRAME_METHOD',
+  RENDERER_RECEIVE_CHANNEL = 'RENDERER_RECEIVE_CHANNEL',
+  RENDERER_REVOKE_CHANNEL = 'RENDERER_REVOKE_CHANNEL',
 
   INSPECTOR_CONFIRM = 'INSPECTOR_CONFIRM',
   INSPECTOR_CONTEXT_MENU = 'INSPECTOR_CONTEXT_MENU',
@@ -1,7 +1,42 @@
 import { EventEmitter } from 'events';
+import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
+import { ipcRendererInternal } from '@electron/internal/renderer/ipc-renderer-internal';
 
 const { ipc } = process._linkedBinding('electron_renderer_ipc');
 
+// Ports of granted channels that have not been asked for yet, and requests
+// for channels that have not been granted yet.
+const grantedPorts = new Map<string, { grantId: number, port: MessagePort }[]>();
+const pendingRequests = new Map<string, ((port: MessagePort) => void)[]>();
+
+function shiftEntry<T> (map: Map<string, T[]>, channel: string) {
+  const entries = map.get(channel);
+  const entry = entries?.shift();
+  if (entries && entries.length === 0) map.delete(channel);
+  return entry;
+}
+
+ipcRendererInternal.on(IPC_MESSAGES.RENDERER_RECEIVE_CHANNEL, (event, channel: string, grantId: number) => {
+  const [port] = event.ports;
+  const resolve = shiftEntry(pendingRequests, channel);
+  if (resolve) {
+    resolve(port);
+  } else {
+    if (!grantedPorts.has(channel)) grantedPorts.set(channel, []);
+    grantedPorts.get(channel)!.push({ grantId, port });
+  }
+});
+
+// The peer went away before this end was asked for.
+ipcRendererInternal.on(IPC_MESSAGES.RENDERER_REVOKE_CHANNEL, (event, channel: string, grantId: number) => {
+  const entries = grantedPorts.get(channel);
+  const index = entries ? entries.findIndex(entry => entry.grantId === grantId) : -1;
+  if (index === -1) return;
+  entries![index].port.close();
+  entries!.splice(index, 1);
+  if (entries!.length === 0) grantedPorts.delete(channel);
+});
+
 const internal = false;
 class IpcRenderer extends EventEmitter implements Electron.IpcRenderer {
   send (channel: string, ...args: any[]) {
@@ -27,6 +62,18 @@ class IpcRenderer extends EventEmitter implements Electron.IpcRenderer {
   postMessage (channel: string, message: any, transferables: any) {
     return ipc.postMessage(channel, message, transferables);
   }
+
+  getChannel (channel: string) {
+    if (typeof channel !== 'string') {
+      throw new TypeError('Missing required channel argument');
+    }
+    const granted = shiftEntry(grantedPorts, channel);
+    if (granted) return Promise.resolve(granted.port);
+    return new Promise<MessagePort>(resolve => {
+      if (!pendingRequests.has(channel)) pendingRequests.set(channel, []);
+      pendingRequests.get(channel)!.push(resolve);
+    });
+  }
 }
 
 export default new IpcRenderer();
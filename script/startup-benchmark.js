@@ -0,0 +1,142 @@
+const cp = require('node:child_process');
+const fs = require('node:fs');
+const os = require('node:os');
+const path = require('node:path');
+
+const utils = require('./lib/utils');
+
+if (!require.main) {
+  throw new Error('Must call the startup benchmark directly');
+}
+
+const args = require('minimist')(process.argv.slice(2), {
+  boolean: ['json', 'cold', 'warm'],
+  string: ['electron', 'output'],
+  default: { runs: 20 }
+});
+
+// The app quits as soon as it is ready and reports its startup profile on
+// stdout, so that the measurement does not include any app specific work.
+const MAIN_JS = `
+const { app } = require('electron');
+app.whenReady().then(() => {
+  process.stdout.write('STARTUP_PROFILE:' + JSON.stringify(process.getStartupProfile()) + '\\n');
+  app.quit();
+});
+`;
+
+const PERCENTILES = [50, 90, 95, 99];
+
+function createApp () {
+  const appDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-startup-benchmark-'));
+  fs.writeFileSync(path.join(appDir, 'package.json'), JSON.stringify({ name: 'electron-startup-benchmark', main: 'main.js' }));
+  fs.writeFileSync(path.join(appDir, 'main.js'), MAIN_JS);
+  return appDir;
+}
+
+function launch (electronPath, appDir, userDataDir) {
+  const launchTime = Date.now();
+  const { stdout, status, error } = cp.spawnSync(electronPath, [appDir, `--user-data-dir=${userDataDir}`], {
+    encoding: 'utf8',
+    env: { ...process.env, ELECTRON_ENABLE_LOGGING: '' }
+  });
+  if (error) throw error;
+  if (status !== 0) throw new Error(`Electron exited with code ${status}`);
+
+  const line = stdout.split('\n').find(l => l.startsWith('STARTUP_PROFILE:'));
+  if (!line) throw new Error('Electron did not report a startup profile');
+  const profile = JSON.parse(line.slice('STARTUP_PROFILE:'.length));
+
+  // Normalize the profile to durations keyed by phase name. Phases that ran
+  // more than once (e.g. several ASAR archives) are summed.
+  const sample = { total: Date.now() - launchTime };
+  for (const { name, startTime, duration } of profile.phases) {
+    if (duration === 0) {
+      sample[name] = startTime;
+    } else {
+      sample[name] = (sample[name] || 0) + duration;
+    }
+  }
+  return sample;
+}
+
+function percentile (sorted, p) {
+  const index = Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1);
+  return sorted[Math.max(0, index)];
+}
+
+function summarize (samples) {
+  const names = new Set(samples.flatMap(sample => Object.keys(sample)));
+  const summary = {};
+  for (const name of names) {
+    const values = samples.map(sample => sample[name]).filter(v => v !== undefined).sort((a, b) => a - b);
+    summary[name] = Object.fromEntries(PERCENTILES.map(p => [`p${p}`, percentile(values, p)]));
+  }
+  return summary;
+}
+
+function run (mode, electronPath, appDir, runs) {
+  const samples = [];
+  const warmUserDataDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-startup-benchmark-data-'));
+  if (mode === 'warm') {
+    // Prime the HTTP, code and GPU caches before measuring.
+    launch(electronPath, appDir, warmUserDataDir);
+  }
+
+  for (let i = 0; i < runs; i++) {
+    // A cold start uses a fresh user data directory so that nothing persisted
+    // by a previous launch can be reused. It does not evict the OS page cache.
+    const userDataDir = mode === 'cold'
+      ? fs.mkdtempSync(path.join(os.tmpdir(), 'electron-startup-benchmark-data-'))
+      : warmUserDataDir;
+    samples.push(launch(electronPath, appDir, userDataDir));
+    if (mode === 'cold') fs.rmSync(userDataDir, { recursive: true, force: true });
+  }
+
+  fs.rmSync(warmUserDataDir, { recursive: true, force: true });
+  return summarize(samples);
+}
+
+function print (mode, summary) {
+  console.log(`\n${mode} start (ms)`);
+  console.table(Object.fromEntries(Object.entries(summary).map(([name, values]) => [
+    name,
+    Object.fromEntries(Object.entries(values).map(([p, v]) => [p, Number(v.toFixed(2))]))
+  ])));
+}
+
+function main () {
+  const electronPath = args.electron ? path.resolve(args.electron) : utils.getAbsoluteElectronExec();
+  const runs = parseInt(args.runs, 10);
+  if (!Number.isInteger(runs) || runs < 1) {
+    throw new Error('--runs must be a positive integer');
+  }
+
+  const modes = (args.cold || args.warm) ? ['cold', 'warm'].filter(mode => args[mode]) : ['cold', 'warm'];
+  const appDir = createApp();
+  const results = {};
+  try {
+    for (const mode of modes) {
+      results[mode] = run(mode, electronPath, appDir, runs);
+    }
+  } finally {
+    fs.rmSync(appDir, { recursive: true, force: true });
+  }
+
+  if (args.output) {
+    fs.writeFileSync(args.output, JSON.stringify({ runs, results }, null, 2));
+  }
+
+  if (args.json) {
+    console.log(JSON.stringify({ runs, results }, null, 2));
+  } else {
+    for (const mode of modes) print(mode, results[mode]);
+  }
+}
+
+try {
+  main();
+} catch (err) {
+  console.error('Startup benchmark failed:', err.message);
+  process.exit(1);
+}
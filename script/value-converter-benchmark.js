@@ -0,0 +1,158 @@
+const cp = require('node:child_process');
+const fs = require('node:fs');
+const os = require('node:os');
+const path = require('node:path');
+
+const utils = require('./lib/utils');
+
+if (!require.main) {
+  throw new Error('Must call the value converter benchmark directly');
+}
+
+const args = require('minimist')(process.argv.slice(2), {
+  boolean: ['json'],
+  string: ['electron', 'output'],
+  default: { runs: 10, iterations: 1000 }
+});
+
+// Compares the converters of shell/common/gin_converters with the code they
+// replaced: base::Value conversion against content::V8ValueConverter, and
+// option structs read from field tables against gin_helper::Dictionary::Get.
+//
+// The comparison goes through the testing binding, which is only compiled in
+// builds with DCHECKs. Use a testing build (build/args/testing.gn), which is
+// optimized but keeps DCHECKs on.
+const MAIN_JS = `
+const { app } = require('electron');
+const { benchmarkValueConverter, benchmarkStructConverter } = process._linkedBinding('electron_common_testing');
+
+const iterations = Number(process.env.BENCHMARK_ITERATIONS);
+const payloads = {
+  objects: Array.from({ length: 200 }, (_, i) => ({
+    id: i,
+    name: 'item' + i,
+    enabled: i % 2 === 0,
+    score: i / 3,
+    tags: ['a', 'b', 'c'],
+    origin: { scheme: 'https', host: 'example.com', port: 443 }
+  })),
+  nested: (function nest (depth) {
+    return depth === 0 ? { leaf: true } : { depth, child: nest(depth - 1), siblings: [depth, String(depth)] };
+  })(50),
+  strings: Array.from({ length: 100 }, (_, i) => 'x'.repeat(1024) + i)
+};
+
+// Read through a field table (gin::ReadStructFields) and through
+// gin_helper::Dictionary::Get, with some options missing as usual.
+const options = {
+  landscape: true,
+  sandbox: false,
+  contextIsolation: true,
+  scale: 1.5,
+  marginTop: 0.4,
+  defaultFontSize: 16,
+  headerTemplate: '<span class="title"></span>',
+  autoplayPolicy: 'user-gesture-required'
+};
+
+app.whenReady().then(() => {
+  const results = {};
+  for (const [name, payload] of Object.entries(payloads)) {
+    // Warm up both paths before measuring.
+    benchmarkValueConverter(payload, Math.ceil(iterations / 10));
+    results[name] = benchmarkValueConverter(payload, iterations);
+  }
+  benchmarkStructConverter(options, Math.ceil(iterations / 10));
+  results.options = benchmarkStructConverter(options, iterations);
+  process.stdout.write('VALUE_CONVERTER:' + JSON.stringify(results) + '\\n');
+  app.quit();
+});
+`;
+
+const PERCENTILES = [50, 90, 95, 99];
+
+function createApp () {
+  const appDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-value-converter-benchmark-'));
+  fs.writeFileSync(path.join(appDir, 'package.json'), JSON.stringify({ name: 'electron-value-converter-benchmark', main: 'main.js' }));
+  fs.writeFileSync(path.join(appDir, 'main.js'), MAIN_JS);
+  return appDir;
+}
+
+function launch (electronPath, appDir, iterations) {
+  const { stdout, status, error } = cp.spawnSync(electronPath, [appDir], {
+    encoding: 'utf8',
+    env: { ...process.env, ELECTRON_ENABLE_LOGGING: '', BENCHMARK_ITERATIONS: String(iterations) }
+  });
+  if (error) throw error;
+  if (status !== 0) throw new Error(`Electron exited with code ${status}`);
+
+  const line = stdout.split('\n').find(l => l.startsWith('VALUE_CONVERTER:'));
+  if (!line) throw new Error('Electron did not report any result, is it a testing build?');
+  return JSON.parse(line.slice('VALUE_CONVERTER:'.length));
+}
+
+function percentile (sorted, p) {
+  const index = Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1);
+  return sorted[Math.max(0, index)];
+}
+
+// Summarizes the time per conversion, in microseconds, of each payload and
+// converter.
+function summarize (samples, iterations) {
+  const summary = {};
+  for (const payload of Object.keys(samples[0])) {
+    for (const converter of Object.keys(samples[0][payload])) {
+      const values = samples.map(sample => sample[payload][converter] * 1000 / iterations).sort((a, b) => a - b);
+      summary[`${payload} (${converter})`] = Object.fromEntries(PERCENTILES.map(p => [`p${p}`, percentile(values, p)]));
+    }
+  }
+  return summary;
+}
+
+function print (summary) {
+  console.log('\nTime per conversion (µs)');
+  console.table(Object.fromEntries(Object.entries(summary).map(([name, values]) => [
+    name,
+    Object.fromEntries(Object.entries(values).map(([p, v]) => [p, Number(v.toFixed(2))]))
+  ])));
+}
+
+function main () {
+  const electronPath = args.electron ? path.resolve(args.electron) : utils.getAbsoluteElectronExec();
+  const runs = parseInt(args.runs, 10);
+  const iterations = parseInt(args.iterations, 10);
+  if (!Number.isInteger(runs) || runs < 1) {
+    throw new Error('--runs must be a positive integer');
+  }
+  if (!Number.isInteger(iterations) || iterations < 1) {
+    throw new Error('--iterations must be a positive integer');
+  }
+
+  const appDir = createApp();
+  const samples = [];
+  try {
+    for (let i = 0; i < runs; i++) {
+      samples.push(launch(electronPath, appDir, iterations));
+    }
+  } finally {
+    fs.rmSync(appDir, { recursive: true, force: true });
+  }
+
+  const results = summarize(samples, iterations);
+  if (args.output) {
+    fs.writeFileSync(args.output, JSON.stringify({ runs, iterations, results }, null, 2));
+  }
+
+  if (args.json) {
+    console.log(JSON.stringify({ runs, iterations, results }, null, 2));
+  } else {
+    print(results);
+  }
+}
+
+try {
+  main();
+} catch (err) {
+  console.error('Value converter benchmark failed:', err.message);
+  process.exit(1);
+}
@@ -11,6 +11,7 @@
 
 #include "base/command_line.h"
 #include "base/files/file_util.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/strings/string_split.h"
 #include "content/public/common/content_constants.h"
 #include "electron/buildflags/buildflags.h"
@@ -20,6 +21,7 @@
 #include "ppapi/buildflags/buildflags.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/process_util.h"
+#include "shell/common/resource_cache.h"
 #include "third_party/widevine/cdm/buildflags.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/resource/resource_bundle.h"
@@ -138,10 +140,24 @@ gfx::Image& ElectronContentClient::GetNativeImageNamed(int resource_id) {
 
 base::RefCountedMemory* ElectronContentClient::GetDataResourceBytes(
     int resource_id) {
+  if (auto* data = ResourceCache::Get()->Load(resource_id))
+    return data;
   return ui::ResourceBundle::GetSharedInstance().LoadDataResourceBytes(
       resource_id);
 }
 
+std::string ElectronContentClient::GetDataResourceString(int resource_id) {
+  // This is how Blink reads its compressed resources. Copying the cached bytes
+  // is still much cheaper than decompressing them.
+  if (scoped_refptr<base::RefCountedMemory> data =
+          ResourceCache::Get()->Load(resource_id)) {
+    return std::string(reinterpret_cast<const char*>(data->data()),
+                       data->size());
+  }
+  return ui::ResourceBundle::GetSharedInstance().LoadDataResourceString(
+      resource_id);
+}
+
 void ElectronContentClient::AddAdditionalSchemes(Schemes* schemes) {
   // Browser Process registration happens in
   // `api::Protocol::RegisterSchemesAsPrivileged`
@@ -28,6 +28,7 @@ class ElectronContentClient : public content::ContentClient {
                                    ui::ResourceScaleFactor) override;
   gfx::Image& GetNativeImageNamed(int resource_id) override;
   base::RefCountedMemory* GetDataResourceBytes(int resource_id) override;
+  std::string GetDataResourceString(int resource_id) override;
   void AddAdditionalSchemes(Schemes* schemes) override;
   void AddPlugins(std::vector<content::ContentPluginInfo>* plugins) override;
   void AddContentDecryptionModules(
@@ -41,6 +41,7 @@
 #include "shell/common/options_switches.h"
 #include "shell/common/platform_util.h"
 #include "shell/common/process_util.h"
+#include "shell/common/startup_profile.h"
 #include "shell/common/thread_restrictions.h"
 #include "shell/renderer/electron_renderer_client.h"
 #include "shell/renderer/electron_sandboxed_renderer_client.h"
@@ -238,6 +239,8 @@ const size_t ElectronMainDelegate::kNonWildcardDomainNonPortSchemesSize =
     std::size(kNonWildcardDomainNonPortSchemes);
 
 std::optional<int> ElectronMainDelegate::BasicStartupComplete() {
+  ScopedStartupPhase startup_phase(
+      "ElectronMainDelegate::BasicStartupComplete");
   auto* command_line = base::CommandLine::ForCurrentProcess();
 
 #if BUILDFLAG(IS_WIN)
@@ -314,6 +317,7 @@ std::optional<int> ElectronMainDelegate::BasicStartupComplete() {
 }
 
 void ElectronMainDelegate::PreSandboxStartup() {
+  ScopedStartupPhase startup_phase("ElectronMainDelegate::PreSandboxStartup");
   auto* command_line = base::CommandLine::ForCurrentProcess();
   std::string process_type = GetProcessType();
 
@@ -398,6 +402,7 @@ void ElectronMainDelegate::SandboxInitialized(const std::string& process_type) {
 }
 
 std::optional<int> ElectronMainDelegate::PreBrowserMain() {
+  ScopedStartupPhase startup_phase("ElectronMainDelegate::PreBrowserMain");
   // This is initialized early because the service manager reads some feature
   // flags and we need to make sure the feature list is initialized before the
   // service manager reads the features.
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_app.h"
 
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
@@ -20,6 +21,8 @@
 #include "base/functional/callback_helpers.h"
 #include "base/path_service.h"
 #include "base/system/sys_info.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/thread_pool.h"
 #include "base/values.h"
 #include "base/win/windows_version.h"
 #include "chrome/browser/browser_process.h"
@@ -76,6 +79,7 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/language_util.h"
+#include "shell/common/main_thread_profiler.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/thread_restrictions.h"
@@ -535,6 +539,26 @@ void OnIconDataAvailable(gin_helper::Promise<gfx::Image> promise,
   }
 }
 
+std::unique_ptr<electron::ProcessMetric> CreateProcessMetric(
+    int process_type,
+    base::ProcessHandle handle,
+    const std::string& service_name = std::string(),
+    const std::string& name = std::string()) {
+  std::unique_ptr<base::ProcessMetrics> metrics;
+  if (process_type == content::PROCESS_TYPE_BROWSER) {
+    metrics = base::ProcessMetrics::CreateCurrentProcessMetrics();
+  } else {
+#if BUILDFLAG(IS_MAC)
+    metrics = base::ProcessMetrics::CreateProcessMetrics(
+        handle, content::BrowserChildProcessHost::GetPortProvider());
+#else
+    metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
+#endif
+  }
+  return std::make_unique<electron::ProcessMetric>(
+      process_type, handle, std::move(metrics), service_name, name);
+}
+
 }  // namespace
 
 App::App() {
@@ -543,10 +567,8 @@ App::App() {
   Browser::Get()->AddObserver(this);
 
   auto pid = content::ChildProcessHost::kInvalidUniqueID;
-  auto process_metric = std::make_unique<electron::ProcessMetric>(
-      content::PROCESS_TYPE_BROWSER, base::GetCurrentProcessHandle(),
-      base::ProcessMetrics::CreateCurrentProcessMetrics());
-  app_metrics_[pid] = std::move(process_metric);
+  app_metrics_[pid] = CreateProcessMetric(content::PROCESS_TYPE_BROWSER,
+                                          base::GetCurrentProcessHandle());
 }
 
 App::~App() {
@@ -837,18 +859,20 @@ void App::ChildProcessLaunched(int process_type,
                                base::ProcessHandle handle,
                                const std::string& service_name,
                                const std::string& name) {
-#if BUILDFLAG(IS_MAC)
-  auto metrics = base::ProcessMetrics::CreateProcessMetrics(
-      handle, content::BrowserChildProcessHost::GetPortProvider());
-#else
-  auto metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
-#endif
-  app_metrics_[pid] = std::make_unique<electron::ProcessMetric>(
-      process_type, handle, std::move(metrics), service_name, name);
+  app_metrics_[pid] =
+      CreateProcessMetric(process_type, handle, service_name, name);
+  // The sampler keeps its own ProcessMetrics, since CPU usage is measured
+  // relative to the previous reading of the same instance.
+  if (metrics_sampler_) {
+    metrics_sampler_.AsyncCall(&AppMetricsSampler::AddProcess)
+        .WithArgs(pid, CreateProcessMetric(process_type, handle));
+  }
 }
 
 void App::ChildProcessDisconnected(int pid) {
   app_metrics_.erase(pid);
+  if (metrics_sampler_)
+    metrics_sampler_.AsyncCall(&AppMetricsSampler::RemoveProcess).WithArgs(pid);
 }
 
 base::FilePath App::GetAppPath() const {
@@ -1361,6 +1385,100 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+void App::StartAppMetricsSampling(gin::Arguments* args) {
+  int interval_ms = 1000;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options) && options.Has("interval") &&
+      (!options.Get("interval", &interval_ms) || interval_ms <= 0)) {
+    args->ThrowTypeError("interval must be a positive integer");
+    return;
+  }
+
+  // Samples taken by an earlier sampler can still be queued, so each one is
+  // tagged with the generation of the sampler that took it.
+  ++metrics_sampler_generation_;
+  metrics_sampler_ = base::SequenceBound<AppMetricsSampler>(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
+      base::Milliseconds(interval_ms),
+      base::BindPostTaskToCurrentDefault(base::BindRepeating(
+          &App::OnAppMetricsSample, weak_factory_.GetWeakPtr(),
+          metrics_sampler_generation_)));
+  for (const auto& [pid, process_metric] : app_metrics_) {
+    metrics_sampler_.AsyncCall(&AppMetricsSampler::AddProcess)
+        .WithArgs(pid, CreateProcessMetric(process_metric->type,
+                                           process_metric->process.Handle()));
+  }
+}
+
+void App::StopAppMetricsSampling() {
+  ++metrics_sampler_generation_;
+  metrics_sampler_.Reset();
+}
+
+void App::OnAppMetricsSample(uint32_t generation,
+                             std::vector<double> processes,
+                             std::vector<int32_t> exited) {
+  // A sample may still arrive after sampling was stopped or restarted.
+  if (generation != metrics_sampler_generation_)
+    return;
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::ArrayBuffer> processes_buffer =
+      v8::ArrayBuffer::New(isolate, processes.size() * sizeof(double));
+  memcpy(processes_buffer->Data(), processes.data(),
+         processes.size() * sizeof(double));
+  v8::Local<v8::ArrayBuffer> exited_buffer =
+      v8::ArrayBuffer::New(isolate, exited.size() * sizeof(int32_t));
+  memcpy(exited_buffer->Data(), exited.data(), exited.size() * sizeof(int32_t));
+
+  auto sample = gin_helper::Dictionary::CreateEmpty(isolate);
+  sample.Set("processes", v8::Float64Array::New(processes_buffer, 0,
+                                                processes.size()));
+  sample.Set("exited", v8::Int32Array::New(exited_buffer, 0, exited.size()));
+  Emit("app-metrics-sample", sample);
+}
+
+std::vector<gin_helper::Dictionary> App::GetMainThreadTaskStats(
+    gin::Arguments* args) {
+  std::vector<gin_helper::Dictionary> result;
+  int duration = MainThreadProfiler::kWindowCount;
+  int count = 20;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    if (options.Has("duration") &&
+        (!options.Get("duration", &duration) || duration <= 0 ||
+         duration > static_cast<int>(MainThreadProfiler::kWindowCount))) {
+      args->ThrowTypeError("duration must be an integer between 1 and 60");
+      return result;
+    }
+    if (options.Has("count") && (!options.Get("count", &count) || count <= 0)) {
+      args->ThrowTypeError("count must be a positive integer");
+      return result;
+    }
+  }
+
+  auto* profiler = MainThreadProfiler::Get();
+  if (!profiler)
+    return result;
+
+  v8::Isolate* isolate = args->isolate();
+  for (const auto& entry :
+       profiler->GetTopEntries(base::Seconds(duration), count)) {
+    auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    dict.Set("name", entry.name);
+    if (!entry.location.empty())
+      dict.Set("location", entry.location);
+    dict.Set("count", static_cast<double>(entry.count));
+    dict.Set("totalTime", entry.total_time.InMillisecondsF());
+    dict.Set("maxTime", entry.max_time.InMillisecondsF());
+    result.push_back(dict);
+  }
+  return result;
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   return gin::ConvertToV8(isolate, content::GetFeatureStatus());
 }
@@ -1487,6 +1605,9 @@ v8::Local<v8::Promise> App::SetProxy(gin::Arguments* args) {
       ->SetValue(proxy_config::prefs::kProxy,
                  base::Value{std::move(proxy_config)},
                  WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  static_cast<BrowserProcessImpl*>(g_browser_process)
+      ->GetResolveProxyHelper()
+      ->ClearCache();
 
   g_browser_process->system_network_context_manager()
       ->GetContext()
@@ -1792,6 +1913,9 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  &App::DisableDomainBlockingFor3DAPIs)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("startAppMetricsSampling", &App::StartAppMetricsSampling)
+      .SetMethod("stopAppMetricsSampling", &App::StopAppMetricsSampling)
+      .SetMethod("getMainThreadTaskStats", &App::GetMainThreadTaskStats)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if IS_MAS_BUILD()
@@ -11,7 +11,9 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
 #include "base/task/cancelable_task_tracker.h"
+#include "base/threading/sequence_bound.h"
 #include "chrome/browser/process_singleton.h"
 #include "content/public/browser/browser_child_process_observer.h"
 #include "content/public/browser/gpu_data_manager_observer.h"
@@ -20,6 +22,7 @@
 #include "net/base/completion_once_callback.h"
 #include "net/base/completion_repeating_callback.h"
 #include "net/ssl/client_cert_identity.h"
+#include "shell/browser/app_metrics_sampler.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/browser_observer.h"
 #include "shell/browser/electron_browser_client.h"
@@ -227,6 +230,13 @@ class App final : public ElectronBrowserClient::Delegate,
                                      gin::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  void StartAppMetricsSampling(gin::Arguments* args);
+  void StopAppMetricsSampling();
+  void OnAppMetricsSample(uint32_t generation,
+                          std::vector<double> processes,
+                          std::vector<int32_t> exited);
+  std::vector<gin_helper::Dictionary> GetMainThreadTaskStats(
+      gin::Arguments* args);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
                                     const std::string& info_type);
@@ -276,9 +286,16 @@ class App final : public ElectronBrowserClient::Delegate,
   // pid -> electron::ProcessMetric
   base::flat_map<int, std::unique_ptr<electron::ProcessMetric>> app_metrics_;
 
+  // Set while app.startAppMetricsSampling() is in effect.
+  base::SequenceBound<AppMetricsSampler> metrics_sampler_;
+  // Bumped whenever |metrics_sampler_| is replaced or reset.
+  uint32_t metrics_sampler_generation_ = 0;
+
   bool disable_hw_acceleration_ = false;
   bool disable_domain_blocking_for_3DAPIs_ = false;
   bool watch_singleton_socket_on_ready_ = false;
+
+  base::WeakPtrFactory<App> weak_factory_{this};
 };
 
 }  // namespace api
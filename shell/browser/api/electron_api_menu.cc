@@ -191,6 +191,10 @@ void Menu::InsertSubMenuAt(int index,
   model_->InsertSubMenuAt(index, command_id, label, menu->model_.get());
 }
 
+void Menu::SetLabel(int index, const std::u16string& label) {
+  model_->SetLabel(index, label);
+}
+
 void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, ui::ImageModel::FromImage(image));
 }
@@ -207,6 +211,10 @@ void Menu::SetRole(int index, const std::u16string& role) {
   model_->SetRole(index, role);
 }
 
+void Menu::ItemChangedAt(int index) {
+  model_->ItemChangedAt(index);
+}
+
 void Menu::Clear() {
   model_->Clear();
 }
@@ -267,6 +275,10 @@ void Menu::OnMenuWillShow() {
   Emit("menu-will-show");
 }
 
+void Menu::OnMenuItemChanged(ElectronMenuModel* model, size_t index) {
+  Emit("-item-changed", static_cast<int>(index));
+}
+
 // static
 void Menu::FillObjectTemplate(v8::Isolate* isolate,
                               v8::Local<v8::ObjectTemplate> templ) {
@@ -276,10 +288,12 @@ void Menu::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("insertRadioItem", &Menu::InsertRadioItemAt)
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
+      .SetMethod("setLabel", &Menu::SetLabel)
       .SetMethod("setIcon", &Menu::SetIcon)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setToolTip", &Menu::SetToolTip)
       .SetMethod("setRole", &Menu::SetRole)
+      .SetMethod("_itemChangedAt", &Menu::ItemChangedAt)
       .SetMethod("clear", &Menu::Clear)
       .SetMethod("getIndexOfCommandId", &Menu::GetIndexOfCommandId)
       .SetMethod("getItemCount", &Menu::GetItemCount)
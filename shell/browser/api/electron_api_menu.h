@@ -94,6 +94,7 @@ class Menu : public gin::Wrappable<Menu>,
   // Observable:
   void OnMenuWillClose() override;
   void OnMenuWillShow() override;
+  void OnMenuItemChanged(ElectronMenuModel* model, size_t index) override;
 
  private:
   void InsertItemAt(int index, int command_id, const std::u16string& label);
@@ -109,10 +110,12 @@ class Menu : public gin::Wrappable<Menu>,
                        int command_id,
                        const std::u16string& label,
                        Menu* menu);
+  void SetLabel(int index, const std::u16string& label);
   void SetIcon(int index, const gfx::Image& image);
   void SetSublabel(int index, const std::u16string& sublabel);
   void SetToolTip(int index, const std::u16string& toolTip);
   void SetRole(int index, const std::u16string& role);
+  void ItemChangedAt(int index);
   void Clear();
   int GetIndexOfCommandId(int command_id) const;
   int GetItemCount() const;
@@ -37,6 +37,9 @@ class MenuMac : public Menu {
   void ClosePopupAt(int32_t window_id) override;
   std::u16string GetAcceleratorTextAtForTesting(int index) const override;
 
+  // ElectronMenuModel::Observer
+  void OnMenuItemChanged(ElectronMenuModel* model, size_t index) override;
+
  private:
   friend class Menu;
 
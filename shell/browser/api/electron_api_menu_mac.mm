@@ -166,6 +166,15 @@ void MenuMac::ClosePopupAt(int32_t window_id) {
       FROM_HERE, std::move(close_popup));
 }
 
+void MenuMac::OnMenuItemChanged(ElectronMenuModel* model, size_t index) {
+  Menu::OnMenuItemChanged(model, index);
+  // The top-level items of the menu bar and of open menus are not validated.
+  const NSInteger item_index = static_cast<NSInteger>(index);
+  [menu_controller_ refreshItemAtIndex:item_index];
+  for (const auto& [window_id, controller] : popup_controllers_)
+    [controller refreshItemAtIndex:item_index];
+}
+
 std::u16string MenuMac::GetAcceleratorTextAtForTesting(int index) const {
   // A least effort to get the real shortcut text of NSMenuItem, the code does
   // not need to be perfect since it is test only.
@@ -74,6 +74,8 @@
 #include "shell/browser/net/cert_verifier_client.h"
 #include "shell/browser/net/resolve_host_function.h"
 #include "shell/browser/session_preferences.h"
+#include "shell/browser/renderer_process_sharing.h"
+#include "shell/browser/warm_renderer_pool.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/content_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
@@ -771,6 +773,7 @@ v8::Local<v8::Promise> Session::SetProxy(gin::Arguments* args) {
       base::Value{
           createProxyConfig(proxy_mode, pac_url, proxy_rules, bypass_list)},
       WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  browser_context_->GetResolveProxyHelper()->ClearCache();
 
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE, base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
@@ -783,6 +786,7 @@ v8::Local<v8::Promise> Session::ForceReloadProxyConfig() {
   gin_helper::Promise<void> promise(isolate_);
   auto handle = promise.GetHandle();
 
+  browser_context_->GetResolveProxyHelper()->ClearCache();
   browser_context_->GetDefaultStoragePartition()
       ->GetNetworkContext()
       ->ForceReloadProxyConfig(base::BindOnce(
@@ -828,11 +832,30 @@ void Session::SetCertVerifyProc(v8::Local<v8::Value> val,
     return;
   }
 
+  base::TimeDelta cache_ttl;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    int cache_ttl_ms = 0;
+    v8::Local<v8::Value> cache_ttl_value;
+    if (options.Get("cacheTTL", &cache_ttl_value) &&
+        !cache_ttl_value->IsUndefined() &&
+        (!gin::ConvertFromV8(args->isolate(), cache_ttl_value,
+                             &cache_ttl_ms) ||
+         cache_ttl_ms < 0)) {
+      args->ThrowTypeError("cacheTTL must be a non-negative integer");
+      return;
+    }
+    cache_ttl = base::Milliseconds(cache_ttl_ms);
+  }
+
   mojo::PendingRemote<network::mojom::CertVerifierClient>
       cert_verifier_client_remote;
+  cert_verifier_client_.reset();
   if (proc) {
+    auto client = std::make_unique<CertVerifierClient>(proc, cache_ttl);
+    cert_verifier_client_ = client->GetWeakPtr();
     mojo::MakeSelfOwnedReceiver(
-        std::make_unique<CertVerifierClient>(proc),
+        std::move(client),
         cert_verifier_client_remote.InitWithNewPipeAndPassReceiver());
   }
   browser_context_->GetDefaultStoragePartition()
@@ -840,6 +863,15 @@ void Session::SetCertVerifyProc(v8::Local<v8::Value> val,
       ->SetCertVerifierClient(std::move(cert_verifier_client_remote));
 }
 
+void Session::ClearCertVerifyProcCache() {
+  if (!cert_verifier_client_)
+    return;
+  cert_verifier_client_->ClearCache();
+  // The network service caches the final verdicts too, in front of the
+  // proc, and can only drop them for every session at once.
+  content::GetNetworkService()->OnCertDBChanged();
+}
+
 void Session::SetPermissionRequestHandler(v8::Local<v8::Value> val,
                                           gin::Arguments* args) {
   auto* permission_manager = static_cast<ElectronPermissionManager*>(
@@ -1074,6 +1106,54 @@ std::vector<base::FilePath> Session::GetPreloads() const {
   return prefs->preloads();
 }
 
+void Session::SetWarmRendererPool(const gin_helper::Dictionary& options,
+                                  gin::Arguments* args) {
+  int size = 0;
+  if (!options.Get("size", &size) || size < 0) {
+    args->ThrowTypeError("size must be a non-negative integer");
+    return;
+  }
+
+  base::Value::Dict web_preferences;
+  if (options.Has("webPreferences") &&
+      !options.Get("webPreferences", &web_preferences)) {
+    args->ThrowTypeError("webPreferences must be an object");
+    return;
+  }
+
+  // The pool is owned by the browser context, which destroys its spare
+  // WebContents before it goes away itself.
+  browser_context()->SetWarmRendererPool(
+      size > 0 ? std::make_unique<WarmRendererPool>(
+                     browser_context(), size, std::move(web_preferences))
+               : nullptr);
+}
+
+void Session::SetRendererProcessSharing(const gin_helper::Dictionary& options,
+                                        gin::Arguments* args) {
+  int max_processes = 0;
+  if (!options.Get("maxProcesses", &max_processes) || max_processes < 0) {
+    args->ThrowTypeError("maxProcesses must be a non-negative integer");
+    return;
+  }
+
+  int windows_per_process = 1;
+  if (options.Has("windowsPerProcess") &&
+      (!options.Get("windowsPerProcess", &windows_per_process) ||
+       windows_per_process < 1)) {
+    args->ThrowTypeError("windowsPerProcess must be a positive integer");
+    return;
+  }
+
+  // Windows that already share a process keep doing so, the new settings
+  // only apply to the processes picked from now on.
+  renderer_process_sharing_.reset();
+  if (max_processes > 0) {
+    renderer_process_sharing_ = std::make_unique<RendererProcessSharing>(
+        max_processes, windows_per_process);
+  }
+}
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 v8::Local<v8::Promise> Session::LoadExtension(
     const base::FilePath& extension_path,
@@ -1278,8 +1358,15 @@ void Session::SetCodeCachePath(gin::Arguments* args) {
           "Absolute path must be provided to store code cache.");
       return;
     }
-    code_cache_context->Initialize(
-        code_cache_path, 0 /* allows disk_cache to choose the size */);
+    // 0 allows disk_cache to choose the size.
+    int64_t max_size = 0;
+    gin_helper::Dictionary options;
+    if (args->GetNext(&options) && options.Get("maxSize", &max_size) &&
+        max_size < 0) {
+      args->ThrowTypeError("maxSize must be a non-negative number");
+      return;
+    }
+    code_cache_context->Initialize(code_cache_path, max_size);
   }
 }
 
@@ -1603,6 +1690,8 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("enableNetworkEmulation", &Session::EnableNetworkEmulation)
       .SetMethod("disableNetworkEmulation", &Session::DisableNetworkEmulation)
       .SetMethod("setCertificateVerifyProc", &Session::SetCertVerifyProc)
+      .SetMethod("clearCertificateVerifyProcCache",
+                 &Session::ClearCertVerifyProcCache)
       .SetMethod("setPermissionRequestHandler",
                  &Session::SetPermissionRequestHandler)
       .SetMethod("setPermissionCheckHandler",
@@ -1629,6 +1718,9 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                  &Session::CreateInterruptedDownload)
       .SetMethod("setPreloads", &Session::SetPreloads)
       .SetMethod("getPreloads", &Session::GetPreloads)
+      .SetMethod("setWarmRendererPool", &Session::SetWarmRendererPool)
+      .SetMethod("setRendererProcessSharing",
+                 &Session::SetRendererProcessSharing)
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
       .SetMethod("loadExtension", &Session::LoadExtension)
       .SetMethod("removeExtension", &Session::RemoveExtension)
@@ -1678,6 +1770,23 @@ namespace {
 
 using electron::api::Session;
 
+bool ValidateCodeCacheOptions(const base::Value::Dict& options,
+                              gin::Arguments* args) {
+  if (const std::string* path = options.FindString("codeCachePath");
+      path && !base::FilePath::FromUTF8Unsafe(*path).IsAbsolute()) {
+    args->ThrowTypeError("codeCachePath must be an absolute path");
+    return false;
+  }
+  if (options.contains("codeCacheMaxSize")) {
+    std::optional<double> max_size = options.FindDouble("codeCacheMaxSize");
+    if (!max_size || *max_size < 0) {
+      args->ThrowTypeError("codeCacheMaxSize must be a non-negative number");
+      return false;
+    }
+  }
+  return true;
+}
+
 v8::Local<v8::Value> FromPartition(const std::string& partition,
                                    gin::Arguments* args) {
   if (!electron::Browser::Get()->is_ready()) {
@@ -1686,6 +1795,8 @@ v8::Local<v8::Value> FromPartition(const std::string& partition,
   }
   base::Value::Dict options;
   args->GetNext(&options);
+  if (!ValidateCodeCacheOptions(options, args))
+    return v8::Null(args->isolate());
   return Session::FromPartition(args->isolate(), partition, std::move(options))
       .ToV8();
 }
@@ -1698,6 +1809,8 @@ v8::Local<v8::Value> FromPath(const base::FilePath& path,
   }
   base::Value::Dict options;
   args->GetNext(&options);
+  if (!ValidateCodeCacheOptions(options, args))
+    return v8::Null(args->isolate());
   std::optional<gin::Handle<Session>> session_handle =
       Session::FromPath(args->isolate(), path, std::move(options));
 
@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -56,7 +57,9 @@ class ProxyConfig;
 
 namespace electron {
 
+class CertVerifierClient;
 class ElectronBrowserContext;
+class RendererProcessSharing;
 
 namespace api {
 
@@ -96,6 +99,10 @@ class Session final : public gin::Wrappable<Session>,
     return &browser_context_.get();
   }
 
+  RendererProcessSharing* renderer_process_sharing() const {
+    return renderer_process_sharing_.get();
+  }
+
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
   static void FillObjectTemplate(v8::Isolate*, v8::Local<v8::ObjectTemplate>);
@@ -117,6 +124,7 @@ class Session final : public gin::Wrappable<Session>,
   void EnableNetworkEmulation(const gin_helper::Dictionary& options);
   void DisableNetworkEmulation();
   void SetCertVerifyProc(v8::Local<v8::Value> proc, gin::Arguments* args);
+  void ClearCertVerifyProcCache();
   void SetPermissionRequestHandler(v8::Local<v8::Value> val,
                                    gin::Arguments* args);
   void SetPermissionCheckHandler(v8::Local<v8::Value> val,
@@ -140,6 +148,10 @@ class Session final : public gin::Wrappable<Session>,
   void CreateInterruptedDownload(const gin_helper::Dictionary& options);
   void SetPreloads(const std::vector<base::FilePath>& preloads);
   std::vector<base::FilePath> GetPreloads() const;
+  void SetWarmRendererPool(const gin_helper::Dictionary& options,
+                           gin::Arguments* args);
+  void SetRendererProcessSharing(const gin_helper::Dictionary& options,
+                                 gin::Arguments* args);
   v8::Local<v8::Value> Cookies(v8::Isolate* isolate);
   v8::Local<v8::Value> Protocol(v8::Isolate* isolate);
   v8::Local<v8::Value> ServiceWorkerContext(v8::Isolate* isolate);
@@ -220,6 +232,12 @@ class Session final : public gin::Wrappable<Session>,
 
   const raw_ref<ElectronBrowserContext> browser_context_;
 
+  // The client installed by setCertificateVerifyProc(), if any. It is owned
+  // by its connection to the network service.
+  base::WeakPtr<CertVerifierClient> cert_verifier_client_;
+
+  std::unique_ptr<RendererProcessSharing> renderer_process_sharing_;
+
   base::WeakPtrFactory<Session> weak_factory_{this};
 };
 
@@ -13,16 +13,22 @@
 #include "base/process/kill.h"
 #include "base/process/launch.h"
 #include "base/process/process.h"
+#include "base/process/process_metrics.h"
+#include "base/system/sys_info.h"
 #include "chrome/browser/browser_process.h"
+#include "content/public/browser/browser_child_process_host.h"
 #include "content/public/browser/child_process_host.h"
 #include "content/public/browser/service_process_host.h"
+#include "content/public/common/process_type.h"
 #include "content/public/common/result_codes.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/browser/api/process_metric.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/net/system_network_context_manager.h"
+#include "shell/common/gin_converters/base_converter.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -54,6 +60,17 @@ GetAllUtilityProcessWrappers() {
 
 namespace api {
 
+namespace {
+
+// Sampling rate used when only a memory limit is given.
+constexpr base::TimeDelta kDefaultResourceUsageInterval = base::Seconds(1);
+
+// Fractions of the memory limit at which the child is told to free memory.
+constexpr double kModeratePressureRatio = 0.7;
+constexpr double kCriticalPressureRatio = 0.9;
+
+}  // namespace
+
 gin::WrapperInfo UtilityProcessWrapper::kWrapperInfo = {
     gin::kEmbedderNativeGin};
 
@@ -64,7 +81,11 @@ UtilityProcessWrapper::UtilityProcessWrapper(
     base::EnvironmentMap env_map,
     base::FilePath current_working_directory,
     bool use_plugin_helper,
-    bool create_network_observer) {
+    bool create_network_observer,
+    uint64_t max_rss_bytes,
+    base::TimeDelta resource_usage_interval)
+    : max_rss_bytes_{max_rss_bytes},
+      resource_usage_interval_{resource_usage_interval} {
 #if BUILDFLAG(IS_WIN)
   base::win::ScopedHandle stdout_write(nullptr);
   base::win::ScopedHandle stderr_write(nullptr);
@@ -241,12 +262,81 @@ void UtilityProcessWrapper::OnServiceProcessLaunch(
   if (url_loader_network_observer_.has_value()) {
     url_loader_network_observer_->set_process_id(pid_);
   }
+  if (resource_usage_interval_.is_positive()) {
+#if BUILDFLAG(IS_MAC)
+    auto metrics = base::ProcessMetrics::CreateProcessMetrics(
+        process.Handle(), content::BrowserChildProcessHost::GetPortProvider());
+#else
+    auto metrics = base::ProcessMetrics::CreateProcessMetrics(process.Handle());
+#endif
+    process_metric_ = std::make_unique<ProcessMetric>(
+        content::PROCESS_TYPE_UTILITY, process.Handle(), std::move(metrics));
+    resource_usage_timer_.Start(
+        FROM_HERE, resource_usage_interval_,
+        base::BindRepeating(&UtilityProcessWrapper::SampleResourceUsage,
+                            base::Unretained(this)));
+  }
   EmitWithoutEvent("spawn");
 }
 
+void UtilityProcessWrapper::StopSampling() {
+  resource_usage_timer_.Stop();
+  process_metric_.reset();
+}
+
+void UtilityProcessWrapper::SampleResourceUsage() {
+#if BUILDFLAG(IS_LINUX)
+  const size_t working_set_size =
+      process_metric_->metrics->GetResidentSetSize();
+#else
+  const size_t working_set_size =
+      process_metric_->GetMemoryInfo().working_set_size;
+#endif
+  double percent_cpu_usage = 0;
+  if (auto usage = process_metric_->metrics->GetCumulativeCPUUsage();
+      usage.has_value()) {
+    percent_cpu_usage =
+        process_metric_->metrics->GetPlatformIndependentCPUUsage(*usage) /
+        base::SysInfo::NumberOfProcessors();
+  }
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  auto details = gin_helper::Dictionary::CreateEmpty(isolate);
+  details.Set("workingSetSize", static_cast<double>(working_set_size >> 10));
+  details.Set("percentCPUUsage", percent_cpu_usage);
+  EmitWithoutEvent("resource-usage", details);
+
+  if (max_rss_bytes_)
+    UpdateMemoryPressure(working_set_size);
+}
+
+void UtilityProcessWrapper::UpdateMemoryPressure(size_t working_set_size) {
+  if (working_set_size >= max_rss_bytes_) {
+    LOG(ERROR) << "Utility process " << pid_ << " exceeded its memory limit";
+    StopSampling();
+    Kill();
+    return;
+  }
+
+  auto level = base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
+  if (working_set_size >= max_rss_bytes_ * kCriticalPressureRatio)
+    level = base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL;
+  else if (working_set_size >= max_rss_bytes_ * kModeratePressureRatio)
+    level = base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE;
+  if (level == memory_pressure_level_)
+    return;
+
+  memory_pressure_level_ = level;
+  if (node_service_remote_.is_connected())
+    node_service_remote_->OnMemoryPressure(level);
+  EmitWithoutEvent("memory-pressure", level);
+}
+
 void UtilityProcessWrapper::HandleTermination(uint64_t exit_code) {
   if (pid_ != base::kNullProcessId)
     GetAllUtilityProcessWrappers().Remove(pid_);
+  StopSampling();
   CloseConnectorPort();
 
   EmitWithoutEvent("exit", exit_code);
@@ -292,6 +382,7 @@ void UtilityProcessWrapper::Shutdown(uint64_t exit_code) {
   if (pid_ != base::kNullProcessId)
     GetAllUtilityProcessWrappers().Remove(pid_);
   node_service_remote_.reset();
+  StopSampling();
   CloseConnectorPort();
   // Emit 'exit' event
   EmitWithoutEvent("exit", exit_code);
@@ -390,6 +481,8 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
   std::u16string display_name;
   bool use_plugin_helper = false;
   bool create_network_observer = false;
+  uint64_t max_rss_bytes = 0;
+  base::TimeDelta resource_usage_interval;
   std::map<IOHandle, IOType> stdio;
   base::FilePath current_working_directory;
   base::EnvironmentMap env_map;
@@ -417,6 +510,18 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
     opts.Get("cwd", &current_working_directory);
     opts.Get("respondToAuthRequestsFromMainProcess", &create_network_observer);
 
+    opts.Get("maxOldGenerationSizeMb", &params->max_old_generation_size_mb);
+    uint64_t max_rss_mb = 0;
+    if (opts.Get("maxRssMb", &max_rss_mb))
+      max_rss_bytes = max_rss_mb * 1024 * 1024;
+    int resource_usage_interval_ms = 0;
+    if (opts.Get("resourceUsageInterval", &resource_usage_interval_ms) &&
+        resource_usage_interval_ms > 0) {
+      resource_usage_interval = base::Milliseconds(resource_usage_interval_ms);
+    } else if (max_rss_bytes) {
+      resource_usage_interval = kDefaultResourceUsageInterval;
+    }
+
     std::vector<std::string> stdio_arr{"ignore", "inherit", "inherit"};
     opts.Get("stdio", &stdio_arr);
     for (size_t i = 0; i < 3; i++) {
@@ -439,7 +544,8 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
       args->isolate(), new UtilityProcessWrapper(
                            std::move(params), display_name, std::move(stdio),
                            env_map, current_working_directory,
-                           use_plugin_helper, create_network_observer));
+                           use_plugin_helper, create_network_observer,
+                           max_rss_bytes, resource_usage_interval));
   handle->Pin(args->isolate());
   return handle;
 }
@@ -11,8 +11,11 @@
 
 #include "base/containers/id_map.h"
 #include "base/environment.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "base/process/process_handle.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "content/public/browser/service_process_host.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/message.h"
@@ -37,6 +40,10 @@ namespace mojo {
 class Connector;
 }  // namespace mojo
 
+namespace electron {
+struct ProcessMetric;
+}  // namespace electron
+
 namespace electron::api {
 
 class UtilityProcessWrapper final
@@ -68,10 +75,16 @@ class UtilityProcessWrapper final
                         base::EnvironmentMap env_map,
                         base::FilePath current_working_directory,
                         bool use_plugin_helper,
-                        bool create_network_observer);
+                        bool create_network_observer,
+                        uint64_t max_rss_bytes,
+                        base::TimeDelta resource_usage_interval);
   void OnServiceProcessLaunch(const base::Process& process);
   void CloseConnectorPort();
 
+  void StopSampling();
+  void SampleResourceUsage();
+  void UpdateMemoryPressure(size_t working_set_size);
+
   void HandleTermination(uint64_t exit_code);
 
   void PostMessage(gin::Arguments* args);
@@ -105,6 +118,15 @@ class UtilityProcessWrapper final
   mojo::Remote<node::mojom::NodeService> node_service_remote_;
   std::optional<electron::URLLoaderNetworkObserver>
       url_loader_network_observer_;
+
+  // The child's memory and CPU usage is sampled from the browser, so that
+  // the limit is enforced even while the child's main thread is busy.
+  const uint64_t max_rss_bytes_;
+  const base::TimeDelta resource_usage_interval_;
+  std::unique_ptr<ProcessMetric> process_metric_;
+  base::RepeatingTimer resource_usage_timer_;
+  base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level_ =
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
   base::WeakPtrFactory<UtilityProcessWrapper> weak_factory_{this};
 };
 
@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -62,6 +63,7 @@
 #include "content/public/browser/site_instance.h"
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/web_contents.h"
+#include "content/public/common/process_type.h"
 #include "content/public/common/referrer_type_converters.h"
 #include "content/public/common/result_codes.h"
 #include "content/public/common/webplugininfo.h"
@@ -86,6 +88,8 @@
 #include "shell/browser/api/electron_api_web_frame_main.h"
 #include "shell/browser/api/frame_subscriber.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/browser/api/process_metric.h"
+#include "shell/browser/background_throttling_budget.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/child_web_contents_tracker.h"
 #include "shell/browser/electron_autofill_driver_factory.h"
@@ -101,6 +105,7 @@
 #include "shell/browser/ui/file_dialog.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
 #include "shell/browser/ui/inspectable_web_contents_view.h"
+#include "shell/browser/warm_renderer_pool.h"
 #include "shell/browser/web_contents_permission_helper.h"
 #include "shell/browser/web_contents_preferences.h"
 #include "shell/browser/web_contents_zoom_controller.h"
@@ -122,6 +127,7 @@
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_converters/optional_converter.h"
 #include "shell/common/gin_converters/osr_converter.h"
+#include "shell/common/gin_converters/struct_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
@@ -148,6 +154,7 @@
 #include "ui/events/base_event_utils.h"
 
 #if BUILDFLAG(IS_MAC)
+#include "content/public/browser/browser_child_process_host.h"
 #include "ui/base/cocoa/defaults_utils.h"
 #endif
 
@@ -669,6 +676,54 @@ content::RenderFrameHost* GetRenderFrameHost(
 
   return frame_host;
 }
+
+#if BUILDFLAG(ENABLE_PRINTING)
+// The settings webContents.printToPDF() validated and filled in.
+struct PrintToPDFSettings {
+  std::optional<int> request_id;
+  std::optional<bool> landscape;
+  std::optional<bool> display_header_footer;
+  std::optional<bool> print_background;
+  std::optional<double> scale;
+  std::optional<double> paper_width;
+  std::optional<double> paper_height;
+  std::optional<double> margin_top;
+  std::optional<double> margin_bottom;
+  std::optional<double> margin_left;
+  std::optional<double> margin_right;
+  std::string page_ranges;
+  std::string header_template;
+  std::string footer_template;
+  std::optional<bool> prefer_css_page_size;
+  std::optional<bool> generate_tagged_pdf;
+  std::optional<bool> generate_document_outline;
+};
+
+constexpr auto kPrintToPDFSettingsFields = std::tuple(
+    gin::StructField{printing::kPreviewRequestID,
+                     &PrintToPDFSettings::request_id},
+    gin::StructField{"landscape", &PrintToPDFSettings::landscape},
+    gin::StructField{"displayHeaderFooter",
+                     &PrintToPDFSettings::display_header_footer},
+    gin::StructField{"printBackground", &PrintToPDFSettings::print_background},
+    gin::StructField{"scale", &PrintToPDFSettings::scale},
+    gin::StructField{"paperWidth", &PrintToPDFSettings::paper_width},
+    gin::StructField{"paperHeight", &PrintToPDFSettings::paper_height},
+    gin::StructField{"marginTop", &PrintToPDFSettings::margin_top},
+    gin::StructField{"marginBottom", &PrintToPDFSettings::margin_bottom},
+    gin::StructField{"marginLeft", &PrintToPDFSettings::margin_left},
+    gin::StructField{"marginRight", &PrintToPDFSettings::margin_right},
+    gin::StructField{"pageRanges", &PrintToPDFSettings::page_ranges},
+    gin::StructField{"headerTemplate", &PrintToPDFSettings::header_template},
+    gin::StructField{"footerTemplate", &PrintToPDFSettings::footer_template},
+    gin::StructField{"preferCSSPageSize",
+                     &PrintToPDFSettings::prefer_css_page_size},
+    gin::StructField{"generateTaggedPDF",
+                     &PrintToPDFSettings::generate_tagged_pdf},
+    gin::StructField{"generateDocumentOutline",
+                     &PrintToPDFSettings::generate_document_outline});
+#endif
+
 }  // namespace
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -841,9 +896,18 @@ WebContents::WebContents(v8::Isolate* isolate,
     web_contents = content::WebContents::Create(params);
     view->SetWebContents(web_contents.get());
   } else {
-    content::WebContents::CreateParams params(session->browser_context());
-    params.initially_hidden = !initially_shown;
-    web_contents = content::WebContents::Create(params);
+    // Prefer a renderer that was launched ahead of time, if the session keeps
+    // a pool of them and one is compatible with our preferences.
+    if (auto* pool = session->browser_context()->warm_renderer_pool())
+      web_contents = pool->Claim(options);
+
+    if (!web_contents) {
+      content::WebContents::CreateParams params(session->browser_context());
+      params.initially_hidden = !initially_shown;
+      web_contents = content::WebContents::Create(params);
+    } else if (initially_shown) {
+      web_contents->WasShown();
+    }
   }
 
   InitWithSessionAndOptions(isolate, std::move(web_contents), session, options);
@@ -911,7 +975,8 @@ void WebContents::InitWithSessionAndOptions(
 
   // Save the preferences in C++.
   // If there's already a WebContentsPreferences object, we created it as part
-  // of the webContents.setWindowOpenHandler path, so don't overwrite it.
+  // of the webContents.setWindowOpenHandler path or claimed the WebContents
+  // from the session's warm renderer pool, so don't overwrite it.
   if (!WebContentsPreferences::From(web_contents())) {
     new WebContentsPreferences(web_contents(), options);
   }
@@ -1629,6 +1694,15 @@ void WebContents::RenderFrameCreated(
     content::RenderFrameHost* render_frame_host) {
   HandleNewRenderFrame(render_frame_host);
 
+  // A new renderer has replaced the one that discard() shut down, or the
+  // one that crashed. It starts out unfrozen, so freeze it again if the page
+  // should still be.
+  if (render_frame_host == web_contents()->GetPrimaryMainFrame()) {
+    discarded_ = false;
+    page_frozen_ = false;
+    UpdatePageFrozen();
+  }
+
   // RenderFrameCreated is called for speculative frames which may not be
   // used in certain cross-origin navigations. Invoking
   // RenderFrameHost::GetLifecycleState currently crashes when called for
@@ -1716,6 +1790,10 @@ void WebContents::RenderViewDeleted(content::RenderViewHost* render_view_host) {
 
 void WebContents::PrimaryMainFrameRenderProcessGone(
     base::TerminationStatus status) {
+  // discard() shut the renderer down on purpose.
+  if (discarded_)
+    return;
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   auto details = gin_helper::Dictionary::CreateEmpty(isolate);
@@ -1724,6 +1802,19 @@ void WebContents::PrimaryMainFrameRenderProcessGone(
   Emit("render-process-gone", details);
 }
 
+void WebContents::OnVisibilityChanged(content::Visibility visibility) {
+  if (visibility != content::Visibility::VISIBLE)
+    return;
+
+  lifecycle_frozen_ = false;
+  UpdatePageFrozen();
+
+  if (discarded_) {
+    discarded_ = false;
+    web_contents()->GetController().LoadIfNecessary();
+  }
+}
+
 void WebContents::PluginCrashed(const base::FilePath& plugin_path,
                                 base::ProcessId plugin_pid) {
 #if BUILDFLAG(ENABLE_PLUGINS)
@@ -1872,10 +1963,15 @@ void WebContents::Message(bool internal,
                           content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::Message", "channel", channel);
   // webContents.emit('-ipc-message', new Event(), internal, channel,
-  // arguments);
+  // serializedMessage);
+  // The arguments are only decoded once JS has decided that a listener
+  // needs them, see deferDeserialization() in ipc-main-impl.ts.
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
   EmitWithSender("-ipc-message", render_frame_host,
                  electron::mojom::ElectronApiIPC::InvokeCallback(), internal,
-                 channel, std::move(arguments));
+                 channel,
+                 SerializedMessage::Create(isolate, std::move(arguments)));
 }
 
 void WebContents::Invoke(
@@ -2033,6 +2129,10 @@ void WebContents::DraggableRegionsChanged(
 
 void WebContents::DidStartNavigation(
     content::NavigationHandle* navigation_handle) {
+  // Navigating a discarded page brings it back even while it is hidden.
+  if (navigation_handle->IsInPrimaryMainFrame())
+    discarded_ = false;
+
   EmitNavigationEvent("did-start-navigation", navigation_handle);
 }
 
@@ -2308,6 +2408,54 @@ void WebContents::SetBackgroundThrottling(bool allowed) {
   }
 }
 
+void WebContents::SetBackgroundThrottlingBudget(gin::Arguments* args) {
+  v8::Local<v8::Value> value;
+  if (!args->GetNext(&value) || value->IsNull()) {
+    background_throttling_budget_.reset();
+    UpdatePageFrozen();
+    return;
+  }
+
+  gin_helper::Dictionary options;
+  double cpu_time = 0;
+  if (!gin::ConvertFromV8(args->isolate(), value, &options) ||
+      !options.Get("cpuTime", &cpu_time) || !(cpu_time >= 0)) {
+    args->ThrowTypeError("cpuTime must be a non-negative number");
+    return;
+  }
+
+  base::TimeDelta interval = BackgroundThrottlingBudget::kDefaultInterval;
+  if (double interval_ms; options.Get("interval", &interval_ms)) {
+    interval = base::Milliseconds(interval_ms);
+    if (!(interval >= BackgroundThrottlingBudget::kMinInterval)) {
+      args->ThrowTypeError("interval must be at least 100 milliseconds");
+      return;
+    }
+  }
+
+  // Invalid options leave the current budget in place.
+  background_throttling_budget_ = std::make_unique<BackgroundThrottlingBudget>(
+      web_contents(), base::Milliseconds(cpu_time), interval,
+      base::BindRepeating(&WebContents::UpdatePageFrozen,
+                          base::Unretained(this)));
+  UpdatePageFrozen();
+}
+
+v8::Local<v8::Value> WebContents::GetBackgroundThrottlingUsage(
+    v8::Isolate* isolate) const {
+  if (!background_throttling_budget_)
+    return v8::Null(isolate);
+
+  BackgroundThrottlingBudget::Usage usage =
+      background_throttling_budget_->GetUsage();
+  return gin::DataObjectBuilder(isolate)
+      .Set("cpuTime", usage.cpu_time.InMillisecondsF())
+      .Set("remainingBudget", usage.balance.InMillisecondsF())
+      .Set("throttled", usage.throttled)
+      .Set("throttledTime", usage.throttled_time.InMillisecondsF())
+      .Build();
+}
+
 int WebContents::GetProcessID() const {
   return web_contents()->GetPrimaryMainFrame()->GetProcess()->GetID();
 }
@@ -2639,6 +2787,78 @@ bool WebContents::IsCrashed() const {
   return web_contents()->IsCrashed();
 }
 
+bool WebContents::Freeze() {
+  // Only hidden pages can be frozen.
+  if (web_contents()->GetVisibility() == content::Visibility::VISIBLE ||
+      discarded_ || IsCrashed())
+    return false;
+
+  lifecycle_frozen_ = true;
+  UpdatePageFrozen();
+  return true;
+}
+
+bool WebContents::IsFrozen() const {
+  return page_frozen_;
+}
+
+v8::Local<v8::Value> WebContents::Discard(v8::Isolate* isolate) {
+  content::RenderProcessHost* process =
+      web_contents()->GetPrimaryMainFrame()->GetProcess();
+  if (web_contents()->GetVisibility() == content::Visibility::VISIBLE ||
+      discarded_ || !process->IsReady())
+    return v8::Null(isolate);
+
+  // Measured the same way as app.getAppMetrics() does, before the process
+  // goes away.
+  base::ProcessHandle handle = process->GetProcess().Handle();
+#if BUILDFLAG(IS_MAC)
+  auto metrics = base::ProcessMetrics::CreateProcessMetrics(
+      handle, content::BrowserChildProcessHost::GetPortProvider());
+#else
+  auto metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
+#endif
+  ProcessMetric metric(content::PROCESS_TYPE_RENDERER, handle,
+                       std::move(metrics));
+#if BUILDFLAG(IS_LINUX)
+  size_t working_set_size = metric.metrics->GetResidentSetSize() >> 10;
+#else
+  size_t working_set_size = metric.GetMemoryInfo().working_set_size >> 10;
+#endif
+
+  // Set first, as the process can be reported gone before this returns.
+  discarded_ = true;
+  // Fails if the process hosts other pages, or if the page has unload
+  // handlers that need to run.
+  if (!process->FastShutdownIfPossible(1, false)) {
+    discarded_ = false;
+    return v8::Null(isolate);
+  }
+
+  lifecycle_frozen_ = false;
+  UpdatePageFrozen();
+  web_contents()->SetWasDiscarded(true);
+  web_contents()->GetController().SetNeedsReload();
+
+  return gin::DataObjectBuilder(isolate)
+      .Set("reclaimedMemory", static_cast<double>(working_set_size))
+      .Build();
+}
+
+bool WebContents::IsDiscarded() const {
+  return discarded_;
+}
+
+void WebContents::UpdatePageFrozen() {
+  bool frozen =
+      lifecycle_frozen_ || (background_throttling_budget_ &&
+                            background_throttling_budget_->throttled());
+  if (frozen == page_frozen_ || !web_contents())
+    return;
+  page_frozen_ = frozen;
+  web_contents()->SetPageFrozen(frozen);
+}
+
 void WebContents::ForcefullyCrashRenderer() {
   content::RenderWidgetHostView* view =
       web_contents()->GetRenderWidgetHostView();
@@ -3110,41 +3330,26 @@ void WebContents::Print(gin::Arguments* args) {
 
 // Partially duplicated and modified from
 // headless/lib/browser/protocol/page_handler.cc;l=41
-v8::Local<v8::Promise> WebContents::PrintToPDF(const base::Value& settings) {
-  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+v8::Local<v8::Promise> WebContents::PrintToPDF(
+    v8::Isolate* isolate,
+    v8::Local<v8::Object> options) {
   gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
-  // This allows us to track headless printing calls.
-  auto unique_id = settings.GetDict().FindInt(printing::kPreviewRequestID);
-  auto landscape = settings.GetDict().FindBool("landscape");
-  auto display_header_footer =
-      settings.GetDict().FindBool("displayHeaderFooter");
-  auto print_background = settings.GetDict().FindBool("printBackground");
-  auto scale = settings.GetDict().FindDouble("scale");
-  auto paper_width = settings.GetDict().FindDouble("paperWidth");
-  auto paper_height = settings.GetDict().FindDouble("paperHeight");
-  auto margin_top = settings.GetDict().FindDouble("marginTop");
-  auto margin_bottom = settings.GetDict().FindDouble("marginBottom");
-  auto margin_left = settings.GetDict().FindDouble("marginLeft");
-  auto margin_right = settings.GetDict().FindDouble("marginRight");
-  auto page_ranges = *settings.GetDict().FindString("pageRanges");
-  auto header_template = *settings.GetDict().FindString("headerTemplate");
-  auto footer_template = *settings.GetDict().FindString("footerTemplate");
-  auto prefer_css_page_size = settings.GetDict().FindBool("preferCSSPageSize");
-  auto generate_tagged_pdf = settings.GetDict().FindBool("generateTaggedPDF");
-  auto generate_document_outline =
-      settings.GetDict().FindBool("generateDocumentOutline");
+  PrintToPDFSettings settings;
+  gin::ReadStructFields(isolate, options, &settings, kPrintToPDFSettingsFields);
 
   content::RenderFrameHost* rfh = GetRenderFrameHostToUse(web_contents());
   absl::variant<printing::mojom::PrintPagesParamsPtr, std::string>
       print_pages_params = print_to_pdf::GetPrintPagesParams(
-          rfh->GetLastCommittedURL(), landscape, display_header_footer,
-          print_background, scale, paper_width, paper_height, margin_top,
-          margin_bottom, margin_left, margin_right,
-          std::make_optional(header_template),
-          std::make_optional(footer_template), prefer_css_page_size,
-          generate_tagged_pdf, generate_document_outline);
+          rfh->GetLastCommittedURL(), settings.landscape,
+          settings.display_header_footer, settings.print_background,
+          settings.scale, settings.paper_width, settings.paper_height,
+          settings.margin_top, settings.margin_bottom, settings.margin_left,
+          settings.margin_right, std::make_optional(settings.header_template),
+          std::make_optional(settings.footer_template),
+          settings.prefer_css_page_size, settings.generate_tagged_pdf,
+          settings.generate_document_outline);
 
   if (absl::holds_alternative<std::string>(print_pages_params)) {
     auto error = absl::get<std::string>(print_pages_params);
@@ -3160,9 +3365,9 @@ v8::Local<v8::Promise> WebContents::PrintToPDF(const base::Value& settings) {
 
   auto params = std::move(
       absl::get<printing::mojom::PrintPagesParamsPtr>(print_pages_params));
-  params->params->document_cookie = unique_id.value_or(0);
+  params->params->document_cookie = settings.request_id.value_or(0);
 
-  manager->PrintToPdf(rfh, page_ranges, std::move(params),
+  manager->PrintToPdf(rfh, settings.page_ranges, std::move(params),
                       base::BindOnce(&WebContents::OnPDFCreated, GetWeakPtr(),
                                      std::move(promise)));
 
@@ -4329,6 +4534,10 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
                  &WebContents::GetBackgroundThrottling)
       .SetMethod("setBackgroundThrottling",
                  &WebContents::SetBackgroundThrottling)
+      .SetMethod("setBackgroundThrottlingBudget",
+                 &WebContents::SetBackgroundThrottlingBudget)
+      .SetMethod("getBackgroundThrottlingUsage",
+                 &WebContents::GetBackgroundThrottlingUsage)
       .SetMethod("getProcessId", &WebContents::GetProcessID)
       .SetMethod("getOSProcessId", &WebContents::GetOSProcessID)
       .SetMethod("equal", &WebContents::Equal)
@@ -4359,6 +4568,10 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("_getHistory", &WebContents::GetHistory)
       .SetMethod("_clearHistory", &WebContents::ClearHistory)
       .SetMethod("isCrashed", &WebContents::IsCrashed)
+      .SetMethod("freeze", &WebContents::Freeze)
+      .SetMethod("isFrozen", &WebContents::IsFrozen)
+      .SetMethod("discard", &WebContents::Discard)
+      .SetMethod("isDiscarded", &WebContents::IsDiscarded)
       .SetMethod("forcefullyCrashRenderer",
                  &WebContents::ForcefullyCrashRenderer)
       .SetMethod("setUserAgent", &WebContents::SetUserAgent)
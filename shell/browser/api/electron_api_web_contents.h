@@ -95,6 +95,7 @@ class SkRegion;
 
 namespace electron {
 
+class BackgroundThrottlingBudget;
 class ElectronBrowserContext;
 class InspectableWebContents;
 class WebContentsZoomController;
@@ -181,6 +182,8 @@ class WebContents final : public ExclusiveAccessContext,
   bool GetBackgroundThrottling() const override;
 
   void SetBackgroundThrottling(bool allowed);
+  void SetBackgroundThrottlingBudget(gin::Arguments* args);
+  v8::Local<v8::Value> GetBackgroundThrottlingUsage(v8::Isolate* isolate) const;
   int GetProcessID() const;
   base::ProcessId GetOSProcessID() const;
   [[nodiscard]] Type type() const { return type_; }
@@ -216,6 +219,10 @@ class WebContents final : public ExclusiveAccessContext,
   std::string GetMediaSourceID(content::WebContents* request_web_contents);
   bool IsCrashed() const;
   void ForcefullyCrashRenderer();
+  bool Freeze();
+  bool IsFrozen() const;
+  v8::Local<v8::Value> Discard(v8::Isolate* isolate);
+  bool IsDiscarded() const;
   void SetUserAgent(const std::string& user_agent);
   std::string GetUserAgent();
   void InsertCSS(const std::string& css);
@@ -252,7 +259,8 @@ class WebContents final : public ExclusiveAccessContext,
                             std::pair<std::string, std::u16string> info);
   void Print(gin::Arguments* args);
   // Print current page as PDF.
-  v8::Local<v8::Promise> PrintToPDF(const base::Value& settings);
+  v8::Local<v8::Promise> PrintToPDF(v8::Isolate* isolate,
+                                    v8::Local<v8::Object> options);
   void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
                     print_to_pdf::PdfPrintResult print_result,
                     scoped_refptr<base::RefCountedMemory> data);
@@ -520,6 +528,10 @@ class WebContents final : public ExclusiveAccessContext,
   // Delete this if garbage collection has not started.
   void DeleteThisIfAlive();
 
+  // Freezes or unfreezes the page according to freeze() and the background
+  // throttling budget.
+  void UpdatePageFrozen();
+
   // Creates a InspectableWebContents object and takes ownership of
   // |web_contents|.
   void InitWithWebContents(std::unique_ptr<content::WebContents> web_contents,
@@ -650,6 +662,7 @@ class WebContents final : public ExclusiveAccessContext,
   void RenderViewDeleted(content::RenderViewHost*) override;
   void PrimaryMainFrameRenderProcessGone(
       base::TerminationStatus status) override;
+  void OnVisibilityChanged(content::Visibility visibility) override;
   void DOMContentLoaded(content::RenderFrameHost* render_frame_host) override;
   void DidFinishLoad(content::RenderFrameHost* render_frame_host,
                      const GURL& validated_url) override;
@@ -832,6 +845,20 @@ class WebContents final : public ExclusiveAccessContext,
   // Whether background throttling is disabled.
   bool background_throttling_ = true;
 
+  // The CPU time budget of the page while it is hidden, if any.
+  std::unique_ptr<BackgroundThrottlingBudget> background_throttling_budget_;
+
+  // Whether freeze() froze the page. It stays frozen until it is shown.
+  bool lifecycle_frozen_ = false;
+
+  // Whether the page is frozen, for freeze() or for exceeding its background
+  // throttling budget.
+  bool page_frozen_ = false;
+
+  // Whether discard() shut down the renderer of the page. The page is
+  // reloaded from its navigation entry when it is shown again.
+  bool discarded_ = false;
+
   // Whether to enable devtools.
   bool enable_devtools_ = true;
 
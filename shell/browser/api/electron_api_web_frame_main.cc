@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_web_frame_main.h"
 
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -17,8 +18,10 @@
 #include "electron/shell/common/api/api.mojom.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/browser/api/serialized_message.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -63,6 +66,73 @@ WebFrameMainIdMap& GetWebFrameMainMap() {
   return *instance;
 }
 
+namespace {
+
+// Scripts registered with webFrameMain.registerScript(). IDs start at 1, so
+// that 0 can stand for a script that is not registered, and are not reused
+// after a script is unregistered.
+struct ScriptRegistry {
+  std::map<std::u16string, uint32_t> ids;
+  std::map<uint32_t, const std::u16string*> sources;
+  uint32_t next_id = 1;
+};
+
+ScriptRegistry& GetScriptRegistry() {
+  static base::NoDestructor<ScriptRegistry> instance;
+  return *instance;
+}
+
+uint32_t RegisterScript(const std::u16string& source) {
+  ScriptRegistry& registry = GetScriptRegistry();
+  auto [it, inserted] = registry.ids.try_emplace(source, registry.next_id);
+  if (inserted) {
+    registry.sources.emplace(it->second, &it->first);
+    registry.next_id++;
+  }
+  return it->second;
+}
+
+void UnregisterScript(uint32_t script_id) {
+  ScriptRegistry& registry = GetScriptRegistry();
+  auto it = registry.sources.find(script_id);
+  if (it == registry.sources.end())
+    return;
+  registry.ids.erase(*it->second);
+  registry.sources.erase(it);
+  for (auto& [frame_tree_node_id, frame] : GetWebFrameMainMap())
+    frame->ForgetScript(script_id);
+}
+
+void OnScriptResult(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                    mojom::ScriptResultPtr result) {
+  if (result->is_error()) {
+    promise.RejectWithErrorMessage(result->get_error());
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(gin::ConvertToV8(isolate, result->get_value()));
+}
+
+// Returns the SerializedMessage if it is the only argument, in which case the
+// arguments it holds are forwarded without being decoded and encoded again.
+SerializedMessage* GetForwardedMessage(v8::Isolate* isolate,
+                                       v8::Local<v8::Value> args) {
+  if (!args->IsArray() || args.As<v8::Array>()->Length() != 1)
+    return nullptr;
+  v8::Local<v8::Value> arg;
+  SerializedMessage* message = nullptr;
+  if (!args.As<v8::Array>()->Get(isolate->GetCurrentContext(), 0).ToLocal(
+          &arg) ||
+      !gin::ConvertFromV8(isolate, arg, &message))
+    return nullptr;
+  return message;
+}
+
+}  // namespace
+
 // static
 WebFrameMain* WebFrameMain::FromFrameTreeNodeId(int frame_tree_node_id) {
   WebFrameMainIdMap& frame_map = GetWebFrameMainMap();
@@ -175,6 +245,63 @@ v8::Local<v8::Promise> WebFrameMain::ExecuteJavaScript(
   return handle;
 }
 
+v8::Local<v8::Promise> WebFrameMain::ExecuteScript(
+    gin::Arguments* args,
+    v8::Local<v8::Value> script) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  uint32_t script_id = 0;
+  std::u16string source;
+  if (script->IsUint32()) {
+    script_id = script.As<v8::Uint32>()->Value();
+    if (!GetScriptRegistry().sources.contains(script_id)) {
+      args->ThrowTypeError("Unknown script ID");
+      return handle;
+    }
+  } else if (!gin::ConvertFromV8(args->isolate(), script, &source)) {
+    args->ThrowTypeError("script must be a string or a script ID");
+    return handle;
+  }
+
+  bool user_gesture = false;
+  if (!args->PeekNext().IsEmpty()) {
+    if (!args->PeekNext()->IsBoolean()) {
+      args->ThrowTypeError("userGesture must be a boolean");
+      return handle;
+    }
+    args->GetNext(&user_gesture);
+  }
+
+  if (render_frame_disposed_) {
+    promise.RejectWithErrorMessage(
+        "Render frame was disposed before WebFrameMain could be accessed");
+    return handle;
+  }
+
+  // Called first, as it forgets the scripts sent over a previous connection.
+  const mojo::Remote<mojom::ElectronRenderer>& renderer_api = GetRendererApi();
+  std::optional<std::u16string> script_source;
+  if (script_id == 0)
+    script_source = std::move(source);
+  else if (renderer_scripts_.insert(script_id).second)
+    script_source = *GetScriptRegistry().sources.at(script_id);
+
+  renderer_api->ExecuteScript(
+      script_id, script_source, user_gesture,
+      mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+          base::BindOnce(&OnScriptResult, std::move(promise)),
+          mojom::ScriptResult::NewError(
+              "Render frame was disposed before the script completed")));
+
+  return handle;
+}
+
+void WebFrameMain::ForgetScript(uint32_t script_id) {
+  if (renderer_scripts_.erase(script_id) && renderer_api_)
+    renderer_api_->ForgetScript(script_id);
+}
+
 bool WebFrameMain::Reload() {
   if (!CheckRenderFrame())
     return false;
@@ -185,8 +312,9 @@ void WebFrameMain::Send(v8::Isolate* isolate,
                         bool internal,
                         const std::string& channel,
                         v8::Local<v8::Value> args) {
+  SerializedMessage* forwarded = GetForwardedMessage(isolate, args);
   blink::CloneableMessage message;
-  if (!gin::ConvertFromV8(isolate, args, &message)) {
+  if (!forwarded && !gin::ConvertFromV8(isolate, args, &message)) {
     isolate->ThrowException(v8::Exception::Error(
         gin::StringToV8(isolate, "Failed to serialize arguments")));
     return;
@@ -195,7 +323,19 @@ void WebFrameMain::Send(v8::Isolate* isolate,
   if (!CheckRenderFrame())
     return;
 
-  GetRendererApi()->Message(internal, channel, std::move(message));
+  const mojo::Remote<mojom::ElectronRenderer>& renderer_api = GetRendererApi();
+  mojom::IPCChannelPtr ipc_channel = renderer_channels_.Intern(channel);
+  if (forwarded) {
+    // Large forwarded messages are typically sent to many frames, which can
+    // then all map the same copy of them.
+    if (const auto* region = forwarded->GetSharedRegion()) {
+      renderer_api->MessageShared(internal, std::move(ipc_channel),
+                                  region->Duplicate());
+      return;
+    }
+    message = forwarded->message().ShallowClone();
+  }
+  renderer_api->Message(internal, std::move(ipc_channel), std::move(message));
 }
 
 const mojo::Remote<mojom::ElectronRenderer>& WebFrameMain::GetRendererApi() {
@@ -213,6 +353,8 @@ void WebFrameMain::MaybeSetupMojoConnection() {
   }
 
   if (!renderer_api_) {
+    renderer_channels_.Reset();
+    renderer_scripts_.clear();
     pending_receiver_ = renderer_api_.BindNewPipeAndPassReceiver();
     renderer_api_.set_disconnect_handler(base::BindOnce(
         &WebFrameMain::OnRendererConnectionError, weak_factory_.GetWeakPtr()));
@@ -229,8 +371,11 @@ void WebFrameMain::MaybeSetupMojoConnection() {
 }
 
 void WebFrameMain::TeardownMojoConnection() {
+  RevokeGrantedChannels();
   renderer_api_.reset();
   pending_receiver_.reset();
+  renderer_channels_.Reset();
+  renderer_scripts_.clear();
 }
 
 void WebFrameMain::OnRendererConnectionError() {
@@ -270,6 +415,55 @@ void WebFrameMain::PostMessage(v8::Isolate* isolate,
                                        std::move(transferable_message));
 }
 
+void WebFrameMain::GrantChannel(gin::Arguments* args) {
+  std::string channel;
+  if (!args->GetNext(&channel)) {
+    args->ThrowTypeError("Missing required channel argument");
+    return;
+  }
+
+  WebFrameMain* peer = nullptr;
+  if (!args->GetNext(&peer) || !peer) {
+    args->ThrowTypeError("peer must be a WebFrameMain");
+    return;
+  }
+
+  if (!CheckRenderFrame() || !peer->CheckRenderFrame())
+    return;
+
+  // Each frame gets one end of a fresh pipe, so that messages flow directly
+  // between the two renderers from now on.
+  static uint64_t next_grant_id = 0;
+  const uint64_t grant_id = ++next_grant_id;
+  blink::MessagePortDescriptorPair pipe;
+  GetRendererApi()->ReceiveChannel(channel, grant_id, pipe.TakePort0());
+  peer->GetRendererApi()->ReceiveChannel(channel, grant_id, pipe.TakePort1());
+  if (peer != this) {
+    granted_channels_.emplace(
+        grant_id, GrantedChannel{channel, peer->weak_factory_.GetWeakPtr()});
+    peer->granted_channels_.emplace(
+        grant_id, GrantedChannel{channel, weak_factory_.GetWeakPtr()});
+  }
+}
+
+void WebFrameMain::RevokeGrantedChannel(uint64_t grant_id) {
+  auto iter = granted_channels_.find(grant_id);
+  if (iter == granted_channels_.end())
+    return;
+  std::string channel = std::move(iter->second.channel);
+  granted_channels_.erase(iter);
+  if (renderer_api_)
+    renderer_api_->RevokeChannel(channel, grant_id);
+}
+
+void WebFrameMain::RevokeGrantedChannels() {
+  auto granted_channels = std::exchange(granted_channels_, {});
+  for (auto& [grant_id, granted] : granted_channels) {
+    if (granted.peer)
+      granted.peer->RevokeGrantedChannel(grant_id);
+  }
+}
+
 int WebFrameMain::FrameTreeNodeID() const {
   return frame_tree_node_id_;
 }
@@ -403,9 +597,11 @@ void WebFrameMain::FillObjectTemplate(v8::Isolate* isolate,
                                       v8::Local<v8::ObjectTemplate> templ) {
   gin_helper::ObjectTemplateBuilder(isolate, templ)
       .SetMethod("executeJavaScript", &WebFrameMain::ExecuteJavaScript)
+      .SetMethod("executeScript", &WebFrameMain::ExecuteScript)
       .SetMethod("reload", &WebFrameMain::Reload)
       .SetMethod("_send", &WebFrameMain::Send)
       .SetMethod("_postMessage", &WebFrameMain::PostMessage)
+      .SetMethod("grantChannel", &WebFrameMain::GrantChannel)
       .SetProperty("frameTreeNodeId", &WebFrameMain::FrameTreeNodeID)
       .SetProperty("name", &WebFrameMain::Name)
       .SetProperty("osProcessId", &WebFrameMain::OSProcessID)
@@ -459,6 +655,24 @@ v8::Local<v8::Value> FromIDOrNull(gin_helper::ErrorThrower thrower,
   return WebFrameMain::FromOrNull(thrower.isolate(), rfh).ToV8();
 }
 
+// Encodes |args| once, so that webContents.broadcast() can send them to many
+// frames without encoding them again for each one.
+v8::Local<v8::Value> SerializeMessage(gin_helper::ErrorThrower thrower,
+                                      v8::Local<v8::Value> args) {
+  v8::Isolate* isolate = thrower.isolate();
+  if (electron::SerializedMessage* forwarded =
+          electron::api::GetForwardedMessage(isolate, args))
+    return forwarded->GetWrapper(isolate).ToLocalChecked();
+
+  blink::CloneableMessage message;
+  if (!gin::ConvertFromV8(isolate, args, &message)) {
+    thrower.ThrowError("Failed to serialize arguments");
+    return v8::Local<v8::Value>();
+  }
+  return electron::SerializedMessage::Create(isolate, std::move(message))
+      .ToV8();
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -468,6 +682,9 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.Set("WebFrameMain", WebFrameMain::GetConstructor(context));
   dict.SetMethod("fromId", &FromID);
   dict.SetMethod("fromIdOrNull", &FromIDOrNull);
+  dict.SetMethod("registerScript", &electron::api::RegisterScript);
+  dict.SetMethod("unregisterScript", &electron::api::UnregisterScript);
+  dict.SetMethod("_serializeMessage", &SerializeMessage);
 }
 
 }  // namespace
@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/process/process.h"
@@ -18,6 +20,7 @@
 #include "shell/browser/event_emitter_mixin.h"
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/pinnable.h"
+#include "shell/common/ipc_channel_interner.h"
 #include "third_party/blink/public/mojom/page/page_visibility_state.mojom-forward.h"
 
 class GURL;
@@ -66,6 +69,9 @@ class WebFrameMain final : public gin::Wrappable<WebFrameMain>,
 
   content::RenderFrameHost* render_frame_host() const { return render_frame_; }
 
+  // Makes the renderer drop its compiled copy of an unregistered script.
+  void ForgetScript(uint32_t script_id);
+
   // disable copy
   WebFrameMain(const WebFrameMain&) = delete;
   WebFrameMain& operator=(const WebFrameMain&) = delete;
@@ -99,6 +105,8 @@ class WebFrameMain final : public gin::Wrappable<WebFrameMain>,
 
   v8::Local<v8::Promise> ExecuteJavaScript(gin::Arguments* args,
                                            const std::u16string& code);
+  v8::Local<v8::Promise> ExecuteScript(gin::Arguments* args,
+                                       v8::Local<v8::Value> script);
   bool Reload();
   void Send(v8::Isolate* isolate,
             bool internal,
@@ -108,6 +116,10 @@ class WebFrameMain final : public gin::Wrappable<WebFrameMain>,
                    const std::string& channel,
                    v8::Local<v8::Value> message_value,
                    std::optional<v8::Local<v8::Value>> transfer);
+  void GrantChannel(gin::Arguments* args);
+  // Forgets a channel granted to this frame, whose peer has gone away.
+  void RevokeGrantedChannel(uint64_t grant_id);
+  void RevokeGrantedChannels();
 
   int FrameTreeNodeID() const;
   std::string Name() const;
@@ -127,6 +139,18 @@ class WebFrameMain final : public gin::Wrappable<WebFrameMain>,
 
   mojo::Remote<mojom::ElectronRenderer> renderer_api_;
   mojo::PendingReceiver<mojom::ElectronRenderer> pending_receiver_;
+  // Channels sent over |renderer_api_|.
+  IPCChannelInterner renderer_channels_;
+  // Registered scripts whose source has been sent over |renderer_api_|.
+  base::flat_set<uint32_t> renderer_scripts_;
+
+  struct GrantedChannel {
+    std::string channel;
+    base::WeakPtr<WebFrameMain> peer;
+  };
+  // Channels granted to this frame, by grant id. The peer's end is revoked
+  // when this frame's renderer goes away.
+  base::flat_map<uint64_t, GrantedChannel> granted_channels_;
 
   int frame_tree_node_id_;
 
@@ -11,7 +11,10 @@
 
 #include "base/containers/contains.h"
 #include "base/containers/fixed_flat_map.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/notreached.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "extensions/browser/api/web_request/web_request_info.h"
@@ -21,6 +24,7 @@
 #include "gin/dictionary.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "gin/wrappable.h"
 #include "net/http/http_content_disposition.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_contents.h"
@@ -34,6 +38,7 @@
 #include "shell/common/gin_converters/std_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/main_thread_profiler.h"
 
 static constexpr auto ResourceTypes =
     base::MakeFixedFlatMap<std::string_view,
@@ -93,7 +98,8 @@ extensions::WebRequestResourceType ParseResourceType(std::string_view value) {
 // not use it because it lowercases the header keys, while the webRequest has
 // to pass the original keys.
 v8::Local<v8::Value> HttpResponseHeadersToV8(
-    net::HttpResponseHeaders* headers) {
+    scoped_refptr<const net::HttpResponseHeaders> headers,
+    v8::Isolate* isolate) {
   base::Value::Dict response_headers;
   if (headers) {
     size_t iter = 0;
@@ -119,7 +125,57 @@ v8::Local<v8::Value> HttpResponseHeadersToV8(
       response_headers.EnsureList(key)->Append(value);
     }
   }
-  return gin::ConvertToV8(v8::Isolate::GetCurrent(), response_headers);
+  return gin::ConvertToV8(isolate, response_headers);
+}
+
+// Defers converting a value to V8 until the property holding it is first
+// read, so that listeners only pay for the parts of |details| they use. The
+// value is captured when the event fires, since the request may be gone by
+// the time the listener gets to it.
+class LazyProperty final : public gin::Wrappable<LazyProperty> {
+ public:
+  using Converter = base::OnceCallback<v8::Local<v8::Value>(v8::Isolate*)>;
+
+  static void Set(gin_helper::Dictionary* details,
+                  std::string_view key,
+                  Converter converter) {
+    v8::Isolate* isolate = details->isolate();
+    gin::Handle<LazyProperty> holder =
+        gin::CreateHandle(isolate, new LazyProperty(std::move(converter)));
+    // V8 replaces the property with a plain data property holding the
+    // converted value once the getter has run.
+    details->GetHandle()
+        ->SetLazyDataProperty(isolate->GetCurrentContext(),
+                              gin::StringToV8(isolate, key),
+                              &LazyProperty::Get, holder.ToV8())
+        .Check();
+  }
+
+  // gin::Wrappable
+  static gin::WrapperInfo kWrapperInfo;
+  const char* GetTypeName() override { return "LazyProperty"; }
+
+ private:
+  explicit LazyProperty(Converter converter)
+      : converter_{std::move(converter)} {}
+
+  static void Get(v8::Local<v8::Name> name,
+                  const v8::PropertyCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    LazyProperty* self = nullptr;
+    if (!gin::ConvertFromV8(isolate, info.Data(), &self) || !self->converter_)
+      return;
+    info.GetReturnValue().Set(std::move(self->converter_).Run(isolate));
+  }
+
+  Converter converter_;
+};
+
+gin::WrapperInfo LazyProperty::kWrapperInfo = {gin::kEmbedderNativeGin};
+
+template <typename T>
+v8::Local<v8::Value> ConvertSnapshot(const T& value, v8::Isolate* isolate) {
+  return gin::ConvertToV8(isolate, value);
 }
 
 // Overloaded by multiple types to fill the |details| object.
@@ -137,8 +193,9 @@ void ToDictionary(gin_helper::Dictionary* details,
     details->Set("fromCache", info->response_from_cache);
     details->Set("statusLine", info->response_headers->GetStatusLine());
     details->Set("statusCode", info->response_headers->response_code());
-    details->Set("responseHeaders",
-                 HttpResponseHeadersToV8(info->response_headers.get()));
+    LazyProperty::Set(
+        details, "responseHeaders",
+        base::BindOnce(&HttpResponseHeadersToV8, info->response_headers));
   }
 
   auto* render_frame_host = content::RenderFrameHost::FromID(
@@ -158,13 +215,20 @@ void ToDictionary(gin_helper::Dictionary* details,
 void ToDictionary(gin_helper::Dictionary* details,
                   const network::ResourceRequest& request) {
   details->Set("referrer", request.referrer);
-  if (request.request_body)
-    details->Set("uploadData", *request.request_body);
+  if (request.request_body) {
+    LazyProperty::Set(
+        details, "uploadData",
+        base::BindOnce(
+            &ConvertSnapshot<scoped_refptr<network::ResourceRequestBody>>,
+            request.request_body));
+  }
 }
 
 void ToDictionary(gin_helper::Dictionary* details,
                   const net::HttpRequestHeaders& headers) {
-  details->Set("requestHeaders", headers);
+  LazyProperty::Set(details, "requestHeaders",
+                    base::BindOnce(&ConvertSnapshot<net::HttpRequestHeaders>,
+                                   headers));
 }
 
 void ToDictionary(gin_helper::Dictionary* details, const GURL& location) {
@@ -373,6 +437,7 @@ int WebRequest::HandleOnBeforeRequestResponseEvent(
   ResponseCallback response =
       base::BindOnce(&WebRequest::OnBeforeRequestListenerResult,
                      base::Unretained(this), request_info->id);
+  MainThreadProfiler::ScopedTag profiler_tag("webRequest", "onBeforeRequest");
   info.listener.Run(gin::ConvertToV8(isolate, details), std::move(response));
   return net::ERR_IO_PENDING;
 }
@@ -439,6 +504,8 @@ int WebRequest::HandleOnBeforeSendHeadersResponseEvent(
   ResponseCallback response =
       base::BindOnce(&WebRequest::OnBeforeSendHeadersListenerResult,
                      base::Unretained(this), request_info->id);
+  MainThreadProfiler::ScopedTag profiler_tag("webRequest",
+                                             "onBeforeSendHeaders");
   info.listener.Run(gin::ConvertToV8(isolate, details), std::move(response));
   return net::ERR_IO_PENDING;
 }
@@ -533,6 +600,7 @@ int WebRequest::HandleOnHeadersReceivedResponseEvent(
   ResponseCallback response =
       base::BindOnce(&WebRequest::OnHeadersReceivedListenerResult,
                      base::Unretained(this), request_info->id);
+  MainThreadProfiler::ScopedTag profiler_tag("webRequest", "onHeadersReceived");
   info.listener.Run(gin::ConvertToV8(isolate, details), std::move(response));
   return net::ERR_IO_PENDING;
 }
@@ -706,9 +774,28 @@ void WebRequest::HandleSimpleEvent(SimpleEvent event,
   v8::HandleScope handle_scope(isolate);
   gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
   FillDetails(&details, request_info, args...);
+  MainThreadProfiler::ScopedTag profiler_tag("webRequest",
+                                             GetSimpleEventName(event));
   info.listener.Run(gin::ConvertToV8(isolate, details));
 }
 
+// static
+const char* WebRequest::GetSimpleEventName(SimpleEvent event) {
+  switch (event) {
+    case SimpleEvent::kOnSendHeaders:
+      return "onSendHeaders";
+    case SimpleEvent::kOnBeforeRedirect:
+      return "onBeforeRedirect";
+    case SimpleEvent::kOnResponseStarted:
+      return "onResponseStarted";
+    case SimpleEvent::kOnCompleted:
+      return "onCompleted";
+    case SimpleEvent::kOnErrorOccurred:
+      return "onErrorOccurred";
+  }
+  NOTREACHED();
+}
+
 // static
 gin::Handle<WebRequest> WebRequest::FromOrCreate(
     v8::Isolate* isolate,
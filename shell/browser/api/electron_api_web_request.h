@@ -124,6 +124,8 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
   template <typename Listener, typename Listeners, typename Event>
   void SetListener(Event event, Listeners* listeners, gin::Arguments* args);
 
+  static const char* GetSimpleEventName(SimpleEvent event);
+
   template <typename... Args>
   void HandleSimpleEvent(SimpleEvent event,
                          extensions::WebRequestInfo* info,
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/message_port.h"
 
+#include <limits>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -16,6 +17,7 @@
 #include "gin/data_object_builder.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "shell/browser/api/message_port_ring.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
@@ -24,12 +26,18 @@
 #include "shell/common/v8_value_serializer.h"
 #include "third_party/blink/public/common/messaging/transferable_message.h"
 #include "third_party/blink/public/common/messaging/transferable_message_mojom_traits.h"
+#include "third_party/blink/public/common/messaging/web_message_port.h"
 #include "third_party/blink/public/mojom/messaging/transferable_message.mojom.h"
 
 namespace electron {
 
 namespace {
 
+constexpr size_t kDefaultRingBufferSize = 1024 * 1024;
+
+// Bounds the time spent dispatching messages from a busy ring in one task.
+constexpr size_t kMaxRingMessagesPerTask = 1024;
+
 bool IsValidWrappable(const v8::Local<v8::Value>& obj) {
   v8::Local<v8::Object> port = v8::Local<v8::Object>::Cast(obj);
 
@@ -124,6 +132,30 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     }
   }
 
+  if (outgoing_ring_) {
+    if (!wrapped_ports.empty()) {
+      thrower.ThrowError(
+          "Ports cannot be transferred over the shared memory transport");
+      return;
+    }
+    if (transferable_message.encoded_message.size() >
+        outgoing_ring_->max_record_size()) {
+      thrower.ThrowRangeError(
+          "Message of " +
+          base::NumberToString(transferable_message.encoded_message.size()) +
+          " bytes does not fit in the shared memory buffer");
+      return;
+    }
+    // SerializeV8Value serializes into the start of |owned_encoded_message|,
+    // so the buffer can be handed over without another copy.
+    std::vector<uint8_t> record =
+        std::move(transferable_message.owned_encoded_message);
+    DCHECK_EQ(record.data(), transferable_message.encoded_message.data());
+    record.resize(transferable_message.encoded_message.size());
+    outgoing_ring_->Write(std::move(record));
+    return;
+  }
+
   bool threw_exception = false;
   transferable_message.ports = MessagePort::DisentanglePorts(
       args->isolate(), wrapped_ports, &threw_exception);
@@ -135,6 +167,30 @@ void MessagePort::PostMessage(gin::Arguments* args) {
   connector_->Accept(&mojo_message);
 }
 
+void MessagePort::EnableSharedMemoryTransport(gin::Arguments* args) {
+  if (!IsEntangled() || outgoing_ring_)
+    return;
+
+  uint32_t buffer_size = kDefaultRingBufferSize;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options) && options.Has("bufferSize") &&
+      !options.Get("bufferSize", &buffer_size)) {
+    args->ThrowTypeError("bufferSize must be a positive integer");
+    return;
+  }
+
+  // The setup message travels on the port's pipe, so everything posted
+  // before it is still delivered first.
+  mojo::Message setup_message;
+  outgoing_ring_ = MessagePortRing::CreateWriter(buffer_size, &setup_message);
+  if (!outgoing_ring_) {
+    gin_helper::ErrorThrower(args->isolate())
+        .ThrowError("Failed to allocate shared memory");
+    return;
+  }
+  connector_->Accept(&setup_message);
+}
+
 void MessagePort::Start() {
   if (!IsEntangled())
     return;
@@ -146,11 +202,29 @@ void MessagePort::Start() {
   if (HasPendingActivity())
     Pin();
   connector_->ResumeIncomingMethodCallProcessing();
+  DrainRing();
 }
 
 void MessagePort::Close() {
   if (closed_)
     return;
+  if (outgoing_ring_) {
+    // Messages still waiting for room in the ring are sent over the pipe
+    // instead. The peer empties the ring before it dispatches them, so they
+    // keep their order.
+    for (std::vector<uint8_t>& record : outgoing_ring_->TakePending()) {
+      blink::TransferableMessage message;
+      message.owned_encoded_message = std::move(record);
+      message.encoded_message = message.owned_encoded_message;
+      message.sender_agent_cluster_id =
+          blink::WebMessagePort::GetEmbedderAgentClusterID();
+      mojo::Message mojo_message =
+          blink::mojom::TransferableMessage::WrapAsMessage(std::move(message));
+      connector_->Accept(&mojo_message);
+    }
+    outgoing_ring_.reset();
+  }
+  incoming_ring_.reset();
   if (!IsNeutered()) {
     Disentangle().ReleaseHandle();
     blink::MessagePortDescriptorPair pipe;
@@ -180,7 +254,8 @@ void MessagePort::Entangle(blink::MessagePortDescriptor port) {
   connector_->PauseIncomingMethodCallProcessing();
   connector_->set_incoming_receiver(this);
   connector_->set_connection_error_handler(
-      base::BindOnce(&MessagePort::Close, weak_factory_.GetWeakPtr()));
+      base::BindOnce(&MessagePort::OnConnectionError,
+                     weak_factory_.GetWeakPtr()));
   if (HasPendingActivity())
     Pin();
 }
@@ -234,12 +309,15 @@ std::vector<blink::MessagePortChannel> MessagePort::DisentanglePorts(
   // or cloned ports, throw an error (per section 8.3.3 of the HTML5 spec).
   for (unsigned i = 0; i < ports.size(); ++i) {
     auto* port = ports[i].get();
-    if (!port || port->IsNeutered() || base::Contains(visited, port)) {
+    if (!port || port->IsNeutered() || port->outgoing_ring_ ||
+        port->incoming_ring_ || base::Contains(visited, port)) {
       std::string type;
       if (!port)
         type = "null";
       else if (port->IsNeutered())
         type = "already neutered";
+      else if (port->outgoing_ring_ || port->incoming_ring_)
+        type = "using the shared memory transport";
       else
         type = "a duplicate";
       gin_helper::ErrorThrower(isolate).ThrowError(
@@ -270,6 +348,26 @@ void MessagePort::Unpin() {
 }
 
 bool MessagePort::Accept(mojo::Message* mojo_message) {
+  if (mojo_message->name() == MessagePortRing::kSetupMessageName) {
+    if (incoming_ring_)
+      return false;
+    incoming_ring_ = MessagePortRing::CreateReader(
+        mojo_message, base::BindRepeating(&MessagePort::DrainRing,
+                                          weak_factory_.GetWeakPtr()));
+    if (!incoming_ring_)
+      return false;
+    DrainRing();
+    return true;
+  }
+
+  // Everything in the ring was written before this message was sent.
+  if (incoming_ring_) {
+    DispatchRingMessages(std::numeric_limits<size_t>::max());
+    // The listener may have closed the port.
+    if (closed_)
+      return true;
+  }
+
   blink::TransferableMessage message;
   if (!blink::mojom::TransferableMessage::DeserializeFromMessage(
           std::move(*mojo_message), &message)) {
@@ -287,18 +385,73 @@ bool MessagePort::Accept(mojo::Message* mojo_message) {
   if (!GetWrapper(isolate).ToLocal(&self))
     return false;
 
+  EmitMessage(message_value, std::move(ports));
+  return true;
+}
+
+void MessagePort::EmitMessage(v8::Local<v8::Value> data,
+                              std::vector<gin::Handle<MessagePort>> ports) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::Local<v8::Object> self;
+  if (!GetWrapper(isolate).ToLocal(&self))
+    return;
+
   auto event = gin::DataObjectBuilder(isolate)
-                   .Set("data", message_value)
+                   .Set("data", data)
                    .Set("ports", ports)
                    .Build();
   gin_helper::EmitEvent(isolate, self, "message", event);
+}
+
+void MessagePort::OnConnectionError() {
+  // Like the messages still queued in the pipe, whatever the peer wrote to
+  // the ring before going away is delivered before the port closes.
+  if (started_ && incoming_ring_)
+    DispatchRingMessages(std::numeric_limits<size_t>::max());
+  Close();
+}
+
+bool MessagePort::DispatchRingMessages(size_t max_count) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  for (size_t i = 0; i < max_count; ++i) {
+    std::vector<uint8_t> record;
+    switch (incoming_ring_->Read(&record)) {
+      case MessagePortRing::ReadResult::kRecord: {
+        v8::HandleScope scope(isolate);
+        EmitMessage(DeserializeV8Value(isolate, record), {});
+        // The listener may have closed the port.
+        if (!incoming_ring_)
+          return false;
+        break;
+      }
+      case MessagePortRing::ReadResult::kEmpty:
+        if (!incoming_ring_->WaitForRecords())
+          return false;
+        break;
+      case MessagePortRing::ReadResult::kError:
+        Close();
+        return false;
+    }
+  }
   return true;
 }
 
+void MessagePort::DrainRing() {
+  if (!started_ || !incoming_ring_ ||
+      !DispatchRingMessages(kMaxRingMessagesPerTask))
+    return;
+  // Yield between batches so that a fast writer cannot starve other tasks.
+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&MessagePort::DrainRing, weak_factory_.GetWeakPtr()));
+}
+
 gin::ObjectTemplateBuilder MessagePort::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin::Wrappable<MessagePort>::GetObjectTemplateBuilder(isolate)
       .SetMethod("postMessage", &MessagePort::PostMessage)
+      .SetMethod("enableSharedMemoryTransport",
+                 &MessagePort::EnableSharedMemoryTransport)
       .SetMethod("start", &MessagePort::Start)
       .SetMethod("close", &MessagePort::Close);
 }
@@ -26,6 +26,8 @@ class Connector;
 
 namespace electron {
 
+class MessagePortRing;
+
 // A non-blink version of blink::MessagePort.
 class MessagePort final : public gin::Wrappable<MessagePort>,
                           public gin_helper::CleanedUpAtExit,
@@ -35,6 +37,7 @@ class MessagePort final : public gin::Wrappable<MessagePort>,
   static gin::Handle<MessagePort> Create(v8::Isolate* isolate);
 
   void PostMessage(gin::Arguments* args);
+  void EnableSharedMemoryTransport(gin::Arguments* args);
   void Start();
   void Close();
 
@@ -79,7 +82,22 @@ class MessagePort final : public gin::Wrappable<MessagePort>,
   // mojo::MessageReceiver
   bool Accept(mojo::Message* mojo_message) override;
 
+  void EmitMessage(v8::Local<v8::Value> data,
+                   std::vector<gin::Handle<MessagePort>> ports);
+  void OnConnectionError();
+
+  // Dispatches messages from |incoming_ring_|. Returns true if |max_count|
+  // messages were dispatched and more may be waiting.
+  bool DispatchRingMessages(size_t max_count);
+  void DrainRing();
+
   std::unique_ptr<mojo::Connector> connector_;
+
+  // Set once shared memory transport has been enabled on this port or on its
+  // peer, respectively. See MessagePortRing.
+  std::unique_ptr<MessagePortRing> outgoing_ring_;
+  std::unique_ptr<MessagePortRing> incoming_ring_;
+
   bool started_ = false;
   bool closed_ = false;
 
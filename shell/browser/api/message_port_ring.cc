@@ -0,0 +1,238 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/message_port_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <new>
+#include <utility>
+
+#include "base/memory/ptr_util.h"
+#include "base/task/single_thread_task_runner.h"
+#include "mojo/public/cpp/system/message_pipe.h"
+#include "mojo/public/cpp/system/platform_handle.h"
+
+namespace electron {
+
+// Lives at the start of the shared memory region and is followed by the ring
+// itself. The positions grow monotonically and are reduced modulo the
+// capacity, which is a power of two, when indexing into the ring. Each side
+// keeps its own position in |position_| and only publishes it here, so a
+// misbehaving peer can at worst corrupt the records, never our bookkeeping.
+struct MessagePortRing::Header {
+  // Advanced by the writer. The two halves sit on separate cache lines so
+  // that the writer and the reader do not contend on every record.
+  alignas(64) std::atomic<uint64_t> write_position{0};
+  // Set by the reader when it is about to go idle.
+  std::atomic<uint32_t> reader_waiting{1};
+
+  // Advanced by the reader.
+  alignas(64) std::atomic<uint64_t> read_position{0};
+  // Set by the writer when a record did not fit.
+  std::atomic<uint32_t> writer_waiting{0};
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+// static
+std::unique_ptr<MessagePortRing> MessagePortRing::CreateWriter(
+    size_t capacity,
+    mojo::Message* setup_message) {
+  capacity = std::bit_ceil(std::clamp(capacity, kMinCapacity, kMaxCapacity));
+  base::UnsafeSharedMemoryRegion region =
+      base::UnsafeSharedMemoryRegion::Create(sizeof(Header) + capacity);
+  if (!region.IsValid())
+    return nullptr;
+  base::WritableSharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return nullptr;
+  new (mapping.memory()) Header();
+
+  mojo::MessagePipe pipe;
+  std::vector<mojo::ScopedHandle> handles;
+  handles.emplace_back(mojo::ScopedHandle::From(
+      mojo::WrapUnsafeSharedMemoryRegion(std::move(region))));
+  handles.emplace_back(mojo::ScopedHandle::From(std::move(pipe.handle1)));
+  *setup_message = mojo::Message(kSetupMessageName, 0, 0, 0, &handles);
+
+  return base::WrapUnique(new MessagePortRing(
+      std::move(mapping), std::move(pipe.handle0), base::RepeatingClosure()));
+}
+
+// static
+std::unique_ptr<MessagePortRing> MessagePortRing::CreateReader(
+    mojo::Message* setup_message,
+    base::RepeatingClosure on_readable) {
+  std::vector<mojo::ScopedHandle>* handles = setup_message->mutable_handles();
+  if (!handles || handles->size() != 2)
+    return nullptr;
+
+  base::UnsafeSharedMemoryRegion region =
+      mojo::UnwrapUnsafeSharedMemoryRegion(
+          mojo::ScopedSharedBufferHandle::From(std::move((*handles)[0])));
+  if (!region.IsValid() || region.GetSize() <= sizeof(Header))
+    return nullptr;
+  const size_t capacity = region.GetSize() - sizeof(Header);
+  if (!std::has_single_bit(capacity) || capacity < kMinCapacity ||
+      capacity > kMaxCapacity)
+    return nullptr;
+  base::WritableSharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return nullptr;
+
+  mojo::ScopedMessagePipeHandle signal_pipe =
+      mojo::ScopedMessagePipeHandle::From(std::move((*handles)[1]));
+  if (!signal_pipe.is_valid())
+    return nullptr;
+
+  return base::WrapUnique(new MessagePortRing(
+      std::move(mapping), std::move(signal_pipe), std::move(on_readable)));
+}
+
+MessagePortRing::MessagePortRing(base::WritableSharedMemoryMapping mapping,
+                                 mojo::ScopedMessagePipeHandle signal_pipe,
+                                 base::RepeatingClosure on_signal)
+    : mapping_{std::move(mapping)}, on_signal_{std::move(on_signal)} {
+  signal_connector_ = std::make_unique<mojo::Connector>(
+      std::move(signal_pipe), mojo::Connector::SINGLE_THREADED_SEND,
+      base::SingleThreadTaskRunner::GetCurrentDefault());
+  signal_connector_->set_incoming_receiver(this);
+}
+
+MessagePortRing::~MessagePortRing() = default;
+
+size_t MessagePortRing::max_record_size() const {
+  return data().size() - sizeof(uint32_t);
+}
+
+void MessagePortRing::Write(std::vector<uint8_t> record) {
+  DCHECK_LE(record.size(), max_record_size());
+  pending_.push_back(std::move(record));
+  FlushPending();
+}
+
+base::circular_deque<std::vector<uint8_t>> MessagePortRing::TakePending() {
+  return std::exchange(pending_, {});
+}
+
+MessagePortRing::ReadResult MessagePortRing::Read(
+    std::vector<uint8_t>* record) {
+  Header* ring = header();
+  const uint64_t available =
+      ring->write_position.load(std::memory_order_acquire) - position_;
+  if (available == 0)
+    return ReadResult::kEmpty;
+  if (available > data().size() || available < sizeof(uint32_t))
+    return ReadResult::kError;
+
+  uint32_t length = 0;
+  CopyOut(position_, base::as_writable_bytes(base::span_from_ref(length)));
+  if (length > available - sizeof(uint32_t))
+    return ReadResult::kError;
+  record->resize(length);
+  CopyOut(position_ + sizeof(uint32_t), *record);
+
+  position_ += sizeof(uint32_t) + length;
+  ring->read_position.store(position_, std::memory_order_seq_cst);
+  if (ring->writer_waiting.load(std::memory_order_seq_cst) &&
+      ring->writer_waiting.exchange(0, std::memory_order_seq_cst)) {
+    Signal();
+  }
+  return ReadResult::kRecord;
+}
+
+bool MessagePortRing::WaitForRecords() {
+  Header* ring = header();
+  ring->reader_waiting.store(1, std::memory_order_seq_cst);
+  if (ring->write_position.load(std::memory_order_seq_cst) == position_)
+    return false;
+  // If the writer already took the flag back, its signal is on the way and
+  // will resume reading.
+  return ring->reader_waiting.exchange(0, std::memory_order_seq_cst) == 1;
+}
+
+bool MessagePortRing::TryWrite(base::span<const uint8_t> record) {
+  Header* ring = header();
+  const uint64_t capacity = data().size();
+  const uint64_t used =
+      position_ - ring->read_position.load(std::memory_order_seq_cst);
+  const uint64_t needed = sizeof(uint32_t) + record.size();
+  if (used > capacity || capacity - used < needed)
+    return false;
+
+  const uint32_t length = static_cast<uint32_t>(record.size());
+  CopyIn(position_, base::as_bytes(base::span_from_ref(length)));
+  CopyIn(position_ + sizeof(uint32_t), record);
+
+  position_ += needed;
+  ring->write_position.store(position_, std::memory_order_seq_cst);
+  return true;
+}
+
+void MessagePortRing::FlushPending() {
+  Header* ring = header();
+  bool wrote = false;
+  while (!pending_.empty()) {
+    if (!TryWrite(pending_.front())) {
+      // Ask the reader to signal once it has made room, then try once more in
+      // case it did so before seeing the request.
+      ring->writer_waiting.store(1, std::memory_order_seq_cst);
+      if (!TryWrite(pending_.front()))
+        break;
+    }
+    pending_.pop_front();
+    wrote = true;
+  }
+
+  if (wrote && ring->reader_waiting.load(std::memory_order_seq_cst) &&
+      ring->reader_waiting.exchange(0, std::memory_order_seq_cst)) {
+    Signal();
+  }
+}
+
+void MessagePortRing::Signal() {
+  mojo::Message message(0, 0, 0, 0, nullptr);
+  signal_connector_->Accept(&message);
+}
+
+void MessagePortRing::CopyIn(uint64_t position,
+                             base::span<const uint8_t> bytes) {
+  base::span<uint8_t> ring = data();
+  const size_t offset = position & (ring.size() - 1);
+  const size_t head = std::min(bytes.size(), ring.size() - offset);
+  ring.subspan(offset, head).copy_from(bytes.first(head));
+  ring.first(bytes.size() - head).copy_from(bytes.subspan(head));
+}
+
+void MessagePortRing::CopyOut(uint64_t position,
+                              base::span<uint8_t> bytes) const {
+  base::span<const uint8_t> ring = data();
+  const size_t offset = position & (ring.size() - 1);
+  const size_t head = std::min(bytes.size(), ring.size() - offset);
+  bytes.first(head).copy_from(ring.subspan(offset, head));
+  bytes.subspan(head).copy_from(ring.first(bytes.size() - head));
+}
+
+bool MessagePortRing::Accept(mojo::Message* message) {
+  // The reader is told that records are available, the writer that space
+  // has been freed up.
+  if (on_signal_)
+    on_signal_.Run();
+  else
+    FlushPending();
+  return true;
+}
+
+MessagePortRing::Header* MessagePortRing::header() const {
+  return mapping_.GetMemoryAs<Header>();
+}
+
+base::span<uint8_t> MessagePortRing::data() const {
+  return mapping_.GetMemoryAsSpan<uint8_t>().subspan(sizeof(Header));
+}
+
+}  // namespace electron
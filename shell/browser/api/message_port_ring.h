@@ -0,0 +1,114 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_MESSAGE_PORT_RING_H_
+#define ELECTRON_SHELL_BROWSER_API_MESSAGE_PORT_RING_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/containers/circular_deque.h"
+#include "base/containers/span.h"
+#include "base/functional/callback.h"
+#include "base/memory/shared_memory_mapping.h"
+#include "base/memory/unsafe_shared_memory_region.h"
+#include "mojo/public/cpp/bindings/connector.h"
+#include "mojo/public/cpp/bindings/message.h"
+
+namespace electron {
+
+// One direction of the shared memory transport between two MessagePorts.
+//
+// The writer owns a single-producer single-consumer ring of length-prefixed
+// records in a shared memory region, and hands the region to the reader in a
+// setup message sent over the ports' own pipe. Records are then copied
+// straight into the ring, and a separate pipe is only used to wake up the
+// other side: the writer rings the reader when it was idle, and the reader
+// rings the writer when the writer ran out of space. A busy stream therefore
+// costs a memcpy per message rather than a mojo message per message.
+class MessagePortRing : public mojo::MessageReceiver {
+ public:
+  enum class ReadResult { kRecord, kEmpty, kError };
+
+  // Name of the message that carries the ring to the reader. It is sent on
+  // the MessagePort's pipe, interleaved with the TransferableMessages.
+  static constexpr uint32_t kSetupMessageName = 0x52494e47;  // 'RING'
+
+  static constexpr size_t kMinCapacity = 4 * 1024;
+  static constexpr size_t kMaxCapacity = 64 * 1024 * 1024;
+
+  // Creates the writing end of a ring of at least |capacity| bytes, or
+  // returns nullptr if the shared memory could not be allocated. The message
+  // to pass to the reader is stored in |setup_message|.
+  static std::unique_ptr<MessagePortRing> CreateWriter(
+      size_t capacity,
+      mojo::Message* setup_message);
+
+  // Creates the reading end from a setup message, or returns nullptr if the
+  // message is malformed. |on_readable| is run when the writer signals that
+  // records are available after WaitForRecords() returned false.
+  static std::unique_ptr<MessagePortRing> CreateReader(
+      mojo::Message* setup_message,
+      base::RepeatingClosure on_readable);
+
+  ~MessagePortRing() override;
+
+  // disable copy
+  MessagePortRing(const MessagePortRing&) = delete;
+  MessagePortRing& operator=(const MessagePortRing&) = delete;
+
+  // Largest record that fits in the ring.
+  size_t max_record_size() const;
+
+  // Writer side. Appends |record| to the ring, or queues it locally until
+  // the reader has made room for it. Records are never reordered.
+  void Write(std::vector<uint8_t> record);
+
+  // Writer side. Returns the records that are still waiting for the reader
+  // to make room for them, which the ring will then never write.
+  base::circular_deque<std::vector<uint8_t>> TakePending();
+
+  // Reader side. Copies the oldest record out of the ring into |record|.
+  // Returns kError if the writer left the ring in an inconsistent state.
+  ReadResult Read(std::vector<uint8_t>* record);
+
+  // Reader side. Asks the writer to signal the next record, and returns true
+  // if records arrived in the meantime, in which case no signal will come
+  // and the caller should keep reading.
+  bool WaitForRecords();
+
+ private:
+  struct Header;
+
+  MessagePortRing(base::WritableSharedMemoryMapping mapping,
+                  mojo::ScopedMessagePipeHandle signal_pipe,
+                  base::RepeatingClosure on_signal);
+
+  bool TryWrite(base::span<const uint8_t> record);
+  void FlushPending();
+  void Signal();
+  void CopyIn(uint64_t position, base::span<const uint8_t> bytes);
+  void CopyOut(uint64_t position, base::span<uint8_t> bytes) const;
+
+  // mojo::MessageReceiver
+  bool Accept(mojo::Message* message) override;
+
+  Header* header() const;
+  base::span<uint8_t> data() const;
+
+  base::WritableSharedMemoryMapping mapping_;
+  std::unique_ptr<mojo::Connector> signal_connector_;
+  base::RepeatingClosure on_signal_;
+
+  // The writer's write position or the reader's read position.
+  uint64_t position_ = 0;
+
+  // Records that did not fit in the ring yet. Writer side only.
+  base::circular_deque<std::vector<uint8_t>> pending_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_MESSAGE_PORT_RING_H_
@@ -0,0 +1,83 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/serialized_message.h"
+
+#include <utility>
+
+#include "gin/handle.h"
+#include "gin/object_template_builder.h"
+#include "shell/common/v8_value_serializer.h"
+
+namespace electron {
+
+gin::WrapperInfo SerializedMessage::kWrapperInfo = {gin::kEmbedderNativeGin};
+
+// static
+gin::Handle<SerializedMessage> SerializedMessage::Create(
+    v8::Isolate* isolate,
+    blink::CloneableMessage message) {
+  return gin::CreateHandle(isolate, new SerializedMessage(std::move(message)));
+}
+
+SerializedMessage::SerializedMessage(blink::CloneableMessage message)
+    : message_{std::move(message)} {
+  // The message may still point into the mojo message it was read from.
+  message_.EnsureDataIsOwned();
+}
+
+SerializedMessage::~SerializedMessage() = default;
+
+const base::ReadOnlySharedMemoryRegion* SerializedMessage::GetSharedRegion() {
+  if (shared_region_.IsValid())
+    return &shared_region_;
+
+  const size_t size = message_.encoded_message.size();
+  if (sharing_failed_ || size < kSharedMemoryThreshold ||
+      !message_.blobs.empty() || !message_.file_system_access_tokens.empty())
+    return nullptr;
+
+  base::MappedReadOnlyRegion mapped =
+      base::ReadOnlySharedMemoryRegion::Create(size);
+  if (!mapped.IsValid()) {
+    sharing_failed_ = true;
+    return nullptr;
+  }
+  base::span<uint8_t> bytes = mapped.mapping.GetMemoryAsSpan<uint8_t>(size);
+  bytes.copy_from(message_.encoded_message);
+
+  shared_region_ = std::move(mapped.region);
+  shared_mapping_ = std::move(mapped.mapping);
+  message_.encoded_message = bytes;
+  message_.owned_encoded_message = {};
+  return &shared_region_;
+}
+
+size_t SerializedMessage::GetByteLength() const {
+  return message_.encoded_message.size();
+}
+
+v8::Local<v8::Value> SerializedMessage::Deserialize(
+    v8::Isolate* isolate) const {
+  return DeserializeV8Value(isolate, message_);
+}
+
+v8::Local<v8::Value> SerializedMessage::Peek(v8::Isolate* isolate,
+                                             uint32_t count) const {
+  return DeserializeV8ArrayPrefix(isolate, message_, count);
+}
+
+gin::ObjectTemplateBuilder SerializedMessage::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin::Wrappable<SerializedMessage>::GetObjectTemplateBuilder(isolate)
+      .SetProperty("byteLength", &SerializedMessage::GetByteLength)
+      .SetMethod("deserialize", &SerializedMessage::Deserialize)
+      .SetMethod("peek", &SerializedMessage::Peek);
+}
+
+const char* SerializedMessage::GetTypeName() {
+  return "SerializedMessage";
+}
+
+}  // namespace electron
@@ -0,0 +1,68 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_SERIALIZED_MESSAGE_H_
+#define ELECTRON_SHELL_BROWSER_API_SERIALIZED_MESSAGE_H_
+
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/memory/shared_memory_mapping.h"
+#include "gin/wrappable.h"
+#include "third_party/blink/public/common/messaging/cloneable_message.h"
+
+namespace gin {
+template <typename T>
+class Handle;
+}  // namespace gin
+
+namespace electron {
+
+// Holds the still encoded arguments of an IPC message, so that JS can decide
+// whether to decode them, decode only some of them, or forward them as they
+// are to another frame.
+class SerializedMessage final : public gin::Wrappable<SerializedMessage> {
+ public:
+  static gin::Handle<SerializedMessage> Create(v8::Isolate* isolate,
+                                               blink::CloneableMessage message);
+
+  // disable copy
+  SerializedMessage(const SerializedMessage&) = delete;
+  SerializedMessage& operator=(const SerializedMessage&) = delete;
+
+  // Encoded arguments at least this large are handed to renderers in shared
+  // memory rather than copied into every IPC message that carries them.
+  static constexpr size_t kSharedMemoryThreshold = 64 * 1024;
+
+  const blink::CloneableMessage& message() const { return message_; }
+
+  // Returns a read-only region holding the encoded arguments, creating it on
+  // first use, or nullptr if the message is below kSharedMemoryThreshold,
+  // carries more than encoded bytes, or the region could not be created.
+  const base::ReadOnlySharedMemoryRegion* GetSharedRegion();
+
+  // gin::Wrappable
+  static gin::WrapperInfo kWrapperInfo;
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
+  const char* GetTypeName() override;
+
+ private:
+  explicit SerializedMessage(blink::CloneableMessage message);
+  ~SerializedMessage() override;
+
+  size_t GetByteLength() const;
+  v8::Local<v8::Value> Deserialize(v8::Isolate* isolate) const;
+  v8::Local<v8::Value> Peek(v8::Isolate* isolate, uint32_t count) const;
+
+  blink::CloneableMessage message_;
+
+  // Once shared, |message_| points into |shared_mapping_| instead of owning
+  // a second copy of the bytes.
+  base::ReadOnlySharedMemoryRegion shared_region_;
+  base::WritableSharedMemoryMapping shared_mapping_;
+  bool sharing_failed_ = false;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_SERIALIZED_MESSAGE_H_
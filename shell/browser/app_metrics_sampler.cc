@@ -0,0 +1,100 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/app_metrics_sampler.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/system/sys_info.h"
+#include "shell/browser/api/process_metric.h"
+
+namespace electron {
+
+AppMetricsSampler::Entry::Entry() {
+  reported.fill(std::numeric_limits<double>::quiet_NaN());
+}
+
+AppMetricsSampler::Entry::Entry(Entry&&) = default;
+
+AppMetricsSampler::Entry& AppMetricsSampler::Entry::operator=(Entry&&) =
+    default;
+
+AppMetricsSampler::Entry::~Entry() = default;
+
+AppMetricsSampler::AppMetricsSampler(base::TimeDelta interval,
+                                     SampleCallback callback)
+    : processor_count_{base::SysInfo::NumberOfProcessors()},
+      callback_{std::move(callback)} {
+  timer_.Start(FROM_HERE, interval,
+               base::BindRepeating(&AppMetricsSampler::Sample,
+                                   base::Unretained(this)));
+}
+
+AppMetricsSampler::~AppMetricsSampler() = default;
+
+void AppMetricsSampler::AddProcess(int id,
+                                   std::unique_ptr<ProcessMetric> metric) {
+  Entry entry;
+  entry.metric = std::move(metric);
+  // The first CPU usage reading only establishes the baseline.
+  if (auto usage = entry.metric->metrics->GetCumulativeCPUUsage();
+      usage.has_value()) {
+    entry.metric->metrics->GetPlatformIndependentCPUUsage(*usage);
+  }
+  processes_.insert_or_assign(id, std::move(entry));
+}
+
+void AppMetricsSampler::RemoveProcess(int id) {
+  auto it = processes_.find(id);
+  if (it == processes_.end())
+    return;
+  // Only processes that were reported need to be reported as gone.
+  if (!std::isnan(it->second.reported[kPid]))
+    exited_.push_back(static_cast<int32_t>(it->second.reported[kPid]));
+  processes_.erase(it);
+}
+
+void AppMetricsSampler::Sample() {
+  std::vector<double> changed;
+  for (auto& [id, entry] : processes_) {
+    const ProcessMetric& metric = *entry.metric;
+    std::array<double, kFieldCount> values;
+    values[kPid] = metric.process.Pid();
+
+    values[kPercentCPUUsage] = 0;
+    if (auto usage = metric.metrics->GetCumulativeCPUUsage();
+        usage.has_value()) {
+      values[kPercentCPUUsage] =
+          metric.metrics->GetPlatformIndependentCPUUsage(*usage) /
+          processor_count_;
+    }
+
+#if BUILDFLAG(IS_LINUX)
+    values[kWorkingSetSize] = metric.metrics->GetResidentSetSize() >> 10;
+#else
+    values[kWorkingSetSize] = metric.GetMemoryInfo().working_set_size >> 10;
+#endif
+
+#if BUILDFLAG(IS_WIN)
+    // Not implemented on Windows, see App::GetAppMetrics.
+    values[kIdleWakeupsPerSecond] = 0;
+#else
+    values[kIdleWakeupsPerSecond] = metric.metrics->GetIdleWakeupsPerSecond();
+#endif
+
+    if (values == entry.reported)
+      continue;
+    entry.reported = values;
+    changed.insert(changed.end(), values.begin(), values.end());
+  }
+
+  if (changed.empty() && exited_.empty())
+    return;
+  callback_.Run(std::move(changed), std::exchange(exited_, {}));
+}
+
+}  // namespace electron
@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_APP_METRICS_SAMPLER_H_
+#define ELECTRON_SHELL_BROWSER_APP_METRICS_SAMPLER_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace electron {
+
+struct ProcessMetric;
+
+// Samples the CPU and memory usage of the app's processes on a background
+// sequence, and reports only what changed since the previous sample. Each
+// sample is a flat array of |kFieldCount| values per process, in the order
+// of the Field enum, plus the pids of the processes that went away.
+class AppMetricsSampler {
+ public:
+  enum Field {
+    kPid,
+    kPercentCPUUsage,
+    kWorkingSetSize,
+    kIdleWakeupsPerSecond,
+    kFieldCount,
+  };
+
+  using SampleCallback =
+      base::RepeatingCallback<void(std::vector<double> processes,
+                                   std::vector<int32_t> exited)>;
+
+  AppMetricsSampler(base::TimeDelta interval, SampleCallback callback);
+  ~AppMetricsSampler();
+
+  // disable copy
+  AppMetricsSampler(const AppMetricsSampler&) = delete;
+  AppMetricsSampler& operator=(const AppMetricsSampler&) = delete;
+
+  // |id| is the child process id the process is tracked by in App.
+  void AddProcess(int id, std::unique_ptr<ProcessMetric> metric);
+  void RemoveProcess(int id);
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(Entry&&);
+    Entry& operator=(Entry&&);
+    ~Entry();
+
+    std::unique_ptr<ProcessMetric> metric;
+    // The values that were last reported, NaN until the first report.
+    std::array<double, kFieldCount> reported;
+  };
+
+  void Sample();
+
+  base::flat_map<int, Entry> processes_;
+  std::vector<int32_t> exited_;
+  const int processor_count_;
+  base::RepeatingTimer timer_;
+  SampleCallback callback_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_APP_METRICS_SAMPLER_H_
@@ -0,0 +1,177 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/background_throttling_budget.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/containers/flat_set.h"
+#include "base/functional/bind.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/web_contents.h"
+
+#if BUILDFLAG(IS_MAC)
+#include "content/public/browser/browser_child_process_host.h"
+#endif
+
+namespace electron {
+
+namespace {
+
+// Returns how many WebContents have frames in |process|.
+size_t CountWebContents(content::RenderProcessHost* process) {
+  base::flat_set<content::WebContents*> web_contents;
+  process->ForEachRenderFrameHost(
+      [&web_contents](content::RenderFrameHost* render_frame_host) {
+        web_contents.insert(
+            content::WebContents::FromRenderFrameHost(render_frame_host));
+      });
+  return web_contents.size();
+}
+
+}  // namespace
+
+BackgroundThrottlingBudget::BackgroundThrottlingBudget(
+    content::WebContents* web_contents,
+    base::TimeDelta cpu_time,
+    base::TimeDelta interval,
+    base::RepeatingClosure on_throttled_changed)
+    : content::WebContentsObserver(web_contents),
+      cpu_time_(cpu_time),
+      interval_(interval),
+      on_throttled_changed_(std::move(on_throttled_changed)),
+      balance_(cpu_time) {
+  if (web_contents->GetVisibility() != content::Visibility::VISIBLE)
+    Start();
+}
+
+BackgroundThrottlingBudget::~BackgroundThrottlingBudget() = default;
+
+BackgroundThrottlingBudget::Usage BackgroundThrottlingBudget::GetUsage()
+    const {
+  Usage usage;
+  usage.cpu_time = last_cpu_time_;
+  usage.balance = balance_;
+  usage.throttled = throttled_;
+  usage.throttled_time = throttled_time_;
+  if (throttled_)
+    usage.throttled_time += base::TimeTicks::Now() - throttled_since_;
+  return usage;
+}
+
+void BackgroundThrottlingBudget::OnVisibilityChanged(
+    content::Visibility visibility) {
+  if (visibility == content::Visibility::VISIBLE)
+    Stop();
+  else if (!timer_.IsRunning())
+    Start();
+}
+
+void BackgroundThrottlingBudget::PrimaryMainFrameRenderProcessGone(
+    base::TerminationStatus status) {
+  // The next renderer starts with a full budget.
+  SetThrottled(false);
+  processes_.clear();
+  balance_ = cpu_time_;
+}
+
+void BackgroundThrottlingBudget::WebContentsDestroyed() {
+  timer_.Stop();
+}
+
+void BackgroundThrottlingBudget::Start() {
+  balance_ = cpu_time_;
+  last_cpu_time_ = base::TimeDelta();
+  base::TimeDelta cpu_time;
+  MeasureProcesses(&cpu_time);
+  timer_.Start(FROM_HERE, interval_,
+               base::BindRepeating(&BackgroundThrottlingBudget::Charge,
+                                   base::Unretained(this)));
+}
+
+void BackgroundThrottlingBudget::Stop() {
+  timer_.Stop();
+  SetThrottled(false);
+  processes_.clear();
+  balance_ = cpu_time_;
+}
+
+bool BackgroundThrottlingBudget::MeasureProcesses(base::TimeDelta* cpu_time) {
+  base::flat_set<content::RenderProcessHost*> hosts;
+  web_contents()->ForEachRenderFrameHost(
+      [&hosts](content::RenderFrameHost* render_frame_host) {
+        content::RenderProcessHost* process = render_frame_host->GetProcess();
+        if (process->IsReady())
+          hosts.insert(process);
+      });
+
+  base::flat_map<int, ProcessUsage> processes;
+  bool measured = false;
+  for (content::RenderProcessHost* process : hosts) {
+    ProcessUsage& usage = processes[process->GetID()];
+    auto it = processes_.find(process->GetID());
+    if (it != processes_.end()) {
+      usage = std::move(it->second);
+    } else {
+      base::ProcessHandle handle = process->GetProcess().Handle();
+#if BUILDFLAG(IS_MAC)
+      usage.metrics = base::ProcessMetrics::CreateProcessMetrics(
+          handle, content::BrowserChildProcessHost::GetPortProvider());
+#else
+      usage.metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
+#endif
+      // The first reading only establishes the baseline.
+      usage.cumulative_cpu_time =
+          usage.metrics->GetCumulativeCPUUsage().value_or(base::TimeDelta());
+      continue;
+    }
+
+    auto cumulative_cpu_time = usage.metrics->GetCumulativeCPUUsage();
+    if (!cumulative_cpu_time.has_value())
+      continue;
+    const base::TimeDelta process_cpu_time =
+        *cumulative_cpu_time - usage.cumulative_cpu_time;
+    usage.cumulative_cpu_time = *cumulative_cpu_time;
+    measured = true;
+    // Pages that share a process share its usage too, rather than each of
+    // them paying for all of it. While this page is frozen, what a shared
+    // process uses is down to the other pages, so the page is not charged
+    // for it and can earn its budget back.
+    const size_t sharers = std::max<size_t>(CountWebContents(process), 1);
+    if (throttled_ && sharers > 1)
+      continue;
+    *cpu_time += process_cpu_time / static_cast<int64_t>(sharers);
+  }
+  // Processes that no longer host any frame of the page are forgotten.
+  processes_ = std::move(processes);
+  return measured;
+}
+
+void BackgroundThrottlingBudget::Charge() {
+  base::TimeDelta cpu_time;
+  if (!MeasureProcesses(&cpu_time))
+    return;
+  last_cpu_time_ = cpu_time;
+
+  balance_ = std::min(balance_ + cpu_time_, cpu_time_) - last_cpu_time_;
+  SetThrottled(balance_.is_negative());
+}
+
+void BackgroundThrottlingBudget::SetThrottled(bool throttled) {
+  if (throttled == throttled_)
+    return;
+  throttled_ = throttled;
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (throttled)
+    throttled_since_ = now;
+  else
+    throttled_time_ += now - throttled_since_;
+
+  on_throttled_changed_.Run();
+}
+
+}  // namespace electron
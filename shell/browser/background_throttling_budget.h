@@ -0,0 +1,100 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_BACKGROUND_THROTTLING_BUDGET_H_
+#define ELECTRON_SHELL_BROWSER_BACKGROUND_THROTTLING_BUDGET_H_
+
+#include <memory>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/process/process_metrics.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "content/public/browser/web_contents_observer.h"
+
+namespace electron {
+
+// Limits the CPU time that the renderers of a hidden or occluded WebContents
+// can use. The page earns |cpu_time| per |interval|, up to one interval's
+// worth, and is charged for the CPU time that the processes of its frames
+// used at the end of every interval. A process that also hosts frames of
+// other WebContents is shared evenly between them, and is not charged at all
+// while the page is frozen, as its usage is then down to the other pages.
+// While it is in debt the page should be frozen, so that it runs neither
+// timers nor tasks until the debt is paid off; the owner is told through
+// |on_throttled_changed|, as the page can be frozen for other reasons too.
+class BackgroundThrottlingBudget : private content::WebContentsObserver {
+ public:
+  struct Usage {
+    // The CPU time the page was charged for the last interval.
+    base::TimeDelta cpu_time;
+    // What is left of the budget, negative while the page is frozen.
+    base::TimeDelta balance;
+    bool throttled = false;
+    // How long the page has been frozen for in total.
+    base::TimeDelta throttled_time;
+  };
+
+  static constexpr base::TimeDelta kDefaultInterval = base::Seconds(1);
+  static constexpr base::TimeDelta kMinInterval = base::Milliseconds(100);
+
+  BackgroundThrottlingBudget(content::WebContents* web_contents,
+                             base::TimeDelta cpu_time,
+                             base::TimeDelta interval,
+                             base::RepeatingClosure on_throttled_changed);
+  ~BackgroundThrottlingBudget() override;
+
+  // disable copy
+  BackgroundThrottlingBudget(const BackgroundThrottlingBudget&) = delete;
+  BackgroundThrottlingBudget& operator=(const BackgroundThrottlingBudget&) =
+      delete;
+
+  Usage GetUsage() const;
+  bool throttled() const { return throttled_; }
+
+ private:
+  // content::WebContentsObserver
+  void OnVisibilityChanged(content::Visibility visibility) override;
+  void PrimaryMainFrameRenderProcessGone(
+      base::TerminationStatus status) override;
+  void WebContentsDestroyed() override;
+
+  void Start();
+  void Stop();
+
+  // Measures the CPU usage of the processes of all frames since the last
+  // call, starting to measure those that were not measured yet. Returns
+  // false if the usage of none of them is known yet.
+  bool MeasureProcesses(base::TimeDelta* cpu_time);
+
+  // Charges the page for the CPU time it used since the last call.
+  void Charge();
+
+  void SetThrottled(bool throttled);
+
+  const base::TimeDelta cpu_time_;
+  const base::TimeDelta interval_;
+  base::RepeatingClosure on_throttled_changed_;
+
+  struct ProcessUsage {
+    std::unique_ptr<base::ProcessMetrics> metrics;
+    base::TimeDelta cumulative_cpu_time;
+  };
+  // Keyed by the unique id of the RenderProcessHost.
+  base::flat_map<int, ProcessUsage> processes_;
+
+  base::TimeDelta last_cpu_time_;
+  base::TimeDelta balance_;
+
+  bool throttled_ = false;
+  base::TimeTicks throttled_since_;
+  base::TimeDelta throttled_time_;
+
+  base::RepeatingTimer timer_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_BACKGROUND_THROTTLING_BUDGET_H_
@@ -21,6 +21,7 @@
 #include "shell/common/application_info.h"
 #include "shell/common/gin_converters/login_item_settings_converter.h"
 #include "shell/common/gin_helper/arguments.h"
+#include "shell/common/startup_profile.h"
 #include "shell/common/thread_restrictions.h"
 
 namespace electron {
@@ -199,6 +200,7 @@ void Browser::DidFinishLaunching(base::Value::Dict launch_info) {
   }
 
   is_ready_ = true;
+  StartupProfile::GetInstance()->Mark("Browser::DidFinishLaunching");
   if (ready_promise_) {
     ready_promise_->Resolve();
   }
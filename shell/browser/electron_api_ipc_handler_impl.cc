@@ -9,6 +9,7 @@
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_process_host.h"
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "shell/common/main_thread_profiler.h"
 
 namespace electron {
 ElectronApiIPCHandlerImpl::ElectronApiIPCHandlerImpl(
@@ -36,21 +37,29 @@ void ElectronApiIPCHandlerImpl::OnConnectionError() {
 }
 
 void ElectronApiIPCHandlerImpl::Message(bool internal,
-                                        const std::string& channel,
+                                        mojom::IPCChannelPtr channel,
                                         blink::CloneableMessage arguments) {
+  const std::string* name = ResolveChannel(channel);
+  if (!name)
+    return;
+  MainThreadProfiler::ScopedTag profiler_tag("ipc", *name);
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
-    api_web_contents->Message(internal, channel, std::move(arguments),
+    api_web_contents->Message(internal, *name, std::move(arguments),
                               GetRenderFrameHost());
   }
 }
 void ElectronApiIPCHandlerImpl::Invoke(bool internal,
-                                       const std::string& channel,
+                                       mojom::IPCChannelPtr channel,
                                        blink::CloneableMessage arguments,
                                        InvokeCallback callback) {
+  const std::string* name = ResolveChannel(channel);
+  if (!name)
+    return;
+  MainThreadProfiler::ScopedTag profiler_tag("ipc", *name);
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
-    api_web_contents->Invoke(internal, channel, std::move(arguments),
+    api_web_contents->Invoke(internal, *name, std::move(arguments),
                              std::move(callback), GetRenderFrameHost());
   }
 }
@@ -66,12 +75,16 @@ void ElectronApiIPCHandlerImpl::ReceivePostMessage(
 }
 
 void ElectronApiIPCHandlerImpl::MessageSync(bool internal,
-                                            const std::string& channel,
+                                            mojom::IPCChannelPtr channel,
                                             blink::CloneableMessage arguments,
                                             MessageSyncCallback callback) {
+  const std::string* name = ResolveChannel(channel);
+  if (!name)
+    return;
+  MainThreadProfiler::ScopedTag profiler_tag("ipc", *name);
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
-    api_web_contents->MessageSync(internal, channel, std::move(arguments),
+    api_web_contents->MessageSync(internal, *name, std::move(arguments),
                                   std::move(callback), GetRenderFrameHost());
   }
 }
@@ -89,6 +102,14 @@ content::RenderFrameHost* ElectronApiIPCHandlerImpl::GetRenderFrameHost() {
   return content::RenderFrameHost::FromID(render_frame_host_id_);
 }
 
+const std::string* ElectronApiIPCHandlerImpl::ResolveChannel(
+    const mojom::IPCChannelPtr& channel) {
+  const std::string* name = channels_.Resolve(channel);
+  if (!name)
+    receiver_.ReportBadMessage("Invalid IPC channel");
+  return name;
+}
+
 // static
 void ElectronApiIPCHandlerImpl::Create(
     content::RenderFrameHost* frame_host,
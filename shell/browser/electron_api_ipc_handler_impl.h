@@ -13,6 +13,7 @@
 #include "electron/shell/common/api/api.mojom.h"
 #include "mojo/public/cpp/bindings/associated_receiver.h"
 #include "shell/browser/api/electron_api_web_contents.h"
+#include "shell/common/ipc_channel_interner.h"
 
 namespace content {
 class RenderFrameHost;
@@ -37,16 +38,16 @@ class ElectronApiIPCHandlerImpl : public mojom::ElectronApiIPC,
 
   // mojom::ElectronApiIPC:
   void Message(bool internal,
-               const std::string& channel,
+               mojom::IPCChannelPtr channel,
                blink::CloneableMessage arguments) override;
   void Invoke(bool internal,
-              const std::string& channel,
+              mojom::IPCChannelPtr channel,
               blink::CloneableMessage arguments,
               InvokeCallback callback) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void MessageSync(bool internal,
-                   const std::string& channel,
+                   mojom::IPCChannelPtr channel,
                    blink::CloneableMessage arguments,
                    MessageSyncCallback callback) override;
   void MessageHost(const std::string& channel,
@@ -66,8 +67,12 @@ class ElectronApiIPCHandlerImpl : public mojom::ElectronApiIPC,
 
   content::RenderFrameHost* GetRenderFrameHost();
 
+  const std::string* ResolveChannel(const mojom::IPCChannelPtr& channel);
+
   content::GlobalRenderFrameHostId render_frame_host_id_;
 
+  IPCChannelResolver channels_;
+
   mojo::AssociatedReceiver<mojom::ElectronApiIPC> receiver_{this};
 
   base::WeakPtrFactory<ElectronApiIPCHandlerImpl> weak_factory_{this};
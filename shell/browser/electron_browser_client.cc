@@ -74,6 +74,7 @@
 #include "shell/browser/api/electron_api_app.h"
 #include "shell/browser/api/electron_api_crash_reporter.h"
 #include "shell/browser/api/electron_api_protocol.h"
+#include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_contents.h"
 #include "shell/browser/api/electron_api_web_request.h"
 #include "shell/browser/badging/badge_manager.h"
@@ -102,6 +103,7 @@
 #include "shell/browser/notifications/notification_presenter.h"
 #include "shell/browser/notifications/platform_notification_service.h"
 #include "shell/browser/protocol_registry.h"
+#include "shell/browser/renderer_process_sharing.h"
 #include "shell/browser/serial/electron_serial_delegate.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/browser/ui/devtools_manager_delegate.h"
@@ -390,6 +392,11 @@ void ElectronBrowserClient::RenderProcessWillLaunch(
 
   // ensure the ProcessPreferences is removed later
   host->AddObserver(this);
+
+  if (auto* resource_cache_host =
+          ElectronBrowserMainParts::Get()->resource_cache_host()) {
+    resource_cache_host->RenderProcessWillLaunch(host);
+  }
 }
 
 content::SpeechRecognitionManagerDelegate*
@@ -447,7 +454,24 @@ void ElectronBrowserClient::RegisterPendingSiteInstance(
     content::SiteInstance* pending_site_instance) {
   // Remember the original web contents for the pending renderer process.
   auto* web_contents = content::WebContents::FromRenderFrameHost(rfh);
+
+  // Main frames of sessions that share renderers are placed here, since
+  // this is the last point where the WebContents is known. GetProcess()
+  // consults ShouldTryToUseExistingProcessHost() and IsSuitableHost().
+  RendererProcessSharing* sharing = nullptr;
+  if (!rfh->GetParent() && !pending_site_instance->HasProcess()) {
+    if (auto* session =
+            api::Session::FromBrowserContext(web_contents->GetBrowserContext()))
+      sharing = session->renderer_process_sharing();
+  }
+  const GURL& site_url = pending_site_instance->GetSiteURL();
+  if (sharing)
+    shared_process_ = sharing->PickProcess(web_contents, site_url);
   auto* pending_process = pending_site_instance->GetProcess();
+  shared_process_ = nullptr;
+  if (sharing)
+    sharing->DidPickProcess(web_contents, site_url, pending_process);
+
   pending_processes_[pending_process->GetID()] = web_contents;
 
   if (rfh->GetParent())
@@ -591,12 +615,16 @@ std::string ElectronBrowserClient::GetGeolocationApiKey() {
 content::GeneratedCodeCacheSettings
 ElectronBrowserClient::GetGeneratedCodeCacheSettings(
     content::BrowserContext* context) {
+  auto* browser_context = static_cast<ElectronBrowserContext*>(context);
   // TODO(deepak1556): Use platform cache directory.
-  base::FilePath cache_path = context->GetPath();
+  base::FilePath cache_path = browser_context->code_cache_path();
+  if (cache_path.empty())
+    cache_path = context->GetPath();
   // If we pass 0 for size, disk_cache will pick a default size using the
   // heuristics based on available disk size. These are implemented in
   // disk_cache::PreferredCacheSize in net/disk_cache/cache_util.cc.
-  return content::GeneratedCodeCacheSettings(true, 0, cache_path);
+  return content::GeneratedCodeCacheSettings(
+      true, browser_context->code_cache_max_size(), cache_path);
 }
 
 void ElectronBrowserClient::AllowCertificateError(
@@ -731,6 +759,10 @@ void ElectronBrowserClient::SiteInstanceGotProcessAndSite(
 bool ElectronBrowserClient::IsSuitableHost(
     content::RenderProcessHost* process_host,
     const GURL& site_url) {
+  // While a shared renderer is being picked, only that one will do.
+  if (shared_process_ && process_host != shared_process_)
+    return false;
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   auto* browser_context = process_host->GetBrowserContext();
   extensions::ExtensionRegistry* registry =
@@ -748,6 +780,14 @@ bool ElectronBrowserClient::IsSuitableHost(
 #endif
 }
 
+bool ElectronBrowserClient::ShouldTryToUseExistingProcessHost(
+    content::BrowserContext* browser_context,
+    const GURL& url) {
+  return shared_process_ ||
+         content::ContentBrowserClient::ShouldTryToUseExistingProcessHost(
+             browser_context, url);
+}
+
 bool ElectronBrowserClient::ShouldUseProcessPerSite(
     content::BrowserContext* browser_context,
     const GURL& effective_url) {
@@ -300,6 +300,9 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
       content::BrowserContext* browser_context) override;
   bool IsSuitableHost(content::RenderProcessHost* process_host,
                       const GURL& site_url) override;
+  bool ShouldTryToUseExistingProcessHost(
+      content::BrowserContext* browser_context,
+      const GURL& url) override;
   bool ShouldUseProcessPerSite(content::BrowserContext* browser_context,
                                const GURL& effective_url) override;
   void GetMediaDeviceIDSalt(
@@ -329,6 +332,10 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
 
   base::flat_set<int> renderer_is_subframe_;
 
+  // The process picked by the session's RendererProcessSharing while a
+  // pending site instance is given a process.
+  raw_ptr<content::RenderProcessHost> shared_process_ = nullptr;
+
   std::unique_ptr<PlatformNotificationService> notification_service_;
   std::unique_ptr<NotificationPresenter> notification_presenter_;
 
@@ -55,6 +55,7 @@
 #include "shell/browser/special_storage_policy.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
 #include "shell/browser/ui/webui/accessibility_ui.h"
+#include "shell/browser/warm_renderer_pool.h"
 #include "shell/browser/web_contents_permission_helper.h"
 #include "shell/browser/web_view_manager.h"
 #include "shell/browser/zoom_level_delegate.h"
@@ -337,6 +338,11 @@ ElectronBrowserContext::ElectronBrowserContext(
   base::StringToInt(command_line->GetSwitchValueASCII(switches::kDiskCacheSize),
                     &max_cache_size_);
 
+  if (const std::string* code_cache_path = options.FindString("codeCachePath"))
+    code_cache_path_ = base::FilePath::FromUTF8Unsafe(*code_cache_path);
+  if (auto code_cache_max_size = options.FindDouble("codeCacheMaxSize"))
+    code_cache_max_size_ = static_cast<int64_t>(code_cache_max_size.value());
+
   if (auto* path_value = std::get_if<std::reference_wrapper<const std::string>>(
           &partition_location)) {
     base::PathService::Get(DIR_SESSION_DATA, &path_);
@@ -375,6 +381,8 @@ ElectronBrowserContext::ElectronBrowserContext(
 
 ElectronBrowserContext::~ElectronBrowserContext() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  // The spare WebContents of the pool belong to this context.
+  warm_renderer_pool_.reset();
   NotifyWillBeDestroyed();
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -388,6 +396,12 @@ ElectronBrowserContext::~ElectronBrowserContext() {
   ShutdownStoragePartitions();
 }
 
+void ElectronBrowserContext::SetWarmRendererPool(
+    std::unique_ptr<WarmRendererPool> pool) {
+  // Replacing the pool releases the renderers warmed for the old settings.
+  warm_renderer_pool_ = std::move(pool);
+}
+
 void ElectronBrowserContext::InitPrefs() {
   auto prefs_path = GetPath().Append(FILE_PATH_LITERAL("Preferences"));
   ScopedAllowBlockingForElectron allow_blocking;
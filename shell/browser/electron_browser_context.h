@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_ELECTRON_BROWSER_CONTEXT_H_
 #define ELECTRON_SHELL_BROWSER_ELECTRON_BROWSER_CONTEXT_H_
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -58,6 +59,7 @@ class CookieChangeNotifier;
 class ResolveProxyHelper;
 class WebViewManager;
 class ProtocolRegistry;
+class WarmRendererPool;
 
 using DisplayMediaResponseCallbackJs =
     base::OnceCallback<void(gin::Arguments* args)>;
@@ -112,6 +114,9 @@ class ElectronBrowserContext : public content::BrowserContext {
   std::string GetUserAgent() const;
   bool can_use_http_cache() const { return use_cache_; }
   int max_cache_size() const { return max_cache_size_; }
+  // Empty when the generated code cache should live in the session's path.
+  const base::FilePath& code_cache_path() const { return code_cache_path_; }
+  int64_t code_cache_max_size() const { return code_cache_max_size_; }
   ResolveProxyHelper* GetResolveProxyHelper();
   predictors::PreconnectManager* GetPreconnectManager();
   scoped_refptr<network::SharedURLLoaderFactory> GetURLLoaderFactory();
@@ -168,6 +173,11 @@ class ElectronBrowserContext : public content::BrowserContext {
     return protocol_registry_.get();
   }
 
+  WarmRendererPool* warm_renderer_pool() const {
+    return warm_renderer_pool_.get();
+  }
+  void SetWarmRendererPool(std::unique_ptr<WarmRendererPool> pool);
+
   void SetSSLConfig(network::mojom::SSLConfigPtr config);
   network::mojom::SSLConfigPtr GetSSLConfig();
   void SetSSLConfigClient(mojo::Remote<network::mojom::SSLConfigClient> client);
@@ -231,12 +241,16 @@ class ElectronBrowserContext : public content::BrowserContext {
   scoped_refptr<storage::SpecialStoragePolicy> storage_policy_;
   std::unique_ptr<predictors::PreconnectManager> preconnect_manager_;
   std::unique_ptr<ProtocolRegistry> protocol_registry_;
+  // Its spare WebContents must go before the rest of the context does.
+  std::unique_ptr<WarmRendererPool> warm_renderer_pool_;
 
   std::optional<std::string> user_agent_;
   base::FilePath path_;
   bool in_memory_ = false;
   bool use_cache_ = true;
   int max_cache_size_ = 0;
+  base::FilePath code_cache_path_;
+  int64_t code_cache_max_size_ = 0;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   // Owned by the KeyedService system.
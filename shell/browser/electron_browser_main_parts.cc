@@ -55,14 +55,17 @@
 #include "shell/browser/feature_list.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/media/media_capture_devices_dispatcher.h"
+#include "shell/browser/resource_cache_host.h"
 #include "shell/browser/ui/devtools_manager_delegate.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/application_info.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/gin_helper/trackable_object.h"
 #include "shell/common/logging.h"
+#include "shell/common/main_thread_profiler.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/startup_profile.h"
 #include "ui/base/idle/idle.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/ui_base_switches.h"
@@ -204,6 +207,8 @@ int ElectronBrowserMainParts::GetExitCode() const {
 }
 
 int ElectronBrowserMainParts::PreEarlyInitialization() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PreEarlyInitialization");
   field_trial_list_ = std::make_unique<base::FieldTrialList>();
 #if BUILDFLAG(IS_POSIX)
   HandleSIGCHLD();
@@ -223,13 +228,22 @@ int ElectronBrowserMainParts::PreEarlyInitialization() {
 }
 
 void ElectronBrowserMainParts::PostEarlyInitialization() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PostEarlyInitialization");
   // A workaround was previously needed because there was no ThreadTaskRunner
   // set.  If this check is failing we may need to re-add that workaround
   DCHECK(base::SingleThreadTaskRunner::HasCurrentDefault());
 
+  main_thread_profiler_ = std::make_unique<MainThreadProfiler>();
+
   // The ProxyResolverV8 has setup a complete V8 environment, in order to
   // avoid conflicts we only initialize our V8 environment after that.
-  js_env_ = std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
+  {
+    ScopedStartupPhase startup_phase(
+        "JavascriptEnvironment::JavascriptEnvironment");
+    js_env_ =
+        std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
+  }
 
   v8::HandleScope scope(js_env_->isolate());
 
@@ -256,7 +270,10 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
   node_bindings_->LoadEnvironment(node_env_.get());
 
   // Wait for app
-  node_bindings_->JoinAppCode();
+  {
+    ScopedStartupPhase startup_phase("NodeBindings::JoinAppCode");
+    node_bindings_->JoinAppCode();
+  }
 
   // We already initialized the feature list in PreEarlyInitialization(), but
   // the user JS script would not have had a chance to alter the command-line
@@ -278,6 +295,8 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
 }
 
 int ElectronBrowserMainParts::PreCreateThreads() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PreCreateThreads");
   if (!views::LayoutProvider::Get()) {
     layout_provider_ = std::make_unique<views::LayoutProvider>();
   }
@@ -359,6 +378,8 @@ int ElectronBrowserMainParts::PreCreateThreads() {
 }
 
 void ElectronBrowserMainParts::PostCreateThreads() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PostCreateThreads");
   content::GetIOThreadTaskRunner({})->PostTask(
       FROM_HERE,
       base::BindOnce(&tracing::TracingSamplerProfiler::CreateOnChildThread));
@@ -389,6 +410,8 @@ void ElectronBrowserMainParts::PostDestroyThreads() {
 }
 
 void ElectronBrowserMainParts::ToolkitInitialized() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::ToolkitInitialized");
 #if BUILDFLAG(IS_LINUX)
   auto* linux_ui = ui::GetDefaultLinuxUi();
   CHECK(linux_ui);
@@ -426,6 +449,8 @@ void ElectronBrowserMainParts::ToolkitInitialized() {
 }
 
 int ElectronBrowserMainParts::PreMainMessageLoopRun() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PreMainMessageLoopRun");
   // Run user's main script before most things get initialized, so we can have
   // a chance to setup everything.
   node_bindings_->PrepareEmbedThread();
@@ -468,6 +493,9 @@ int ElectronBrowserMainParts::PreMainMessageLoopRun() {
     DevToolsManagerDelegate::StartHttpHandler();
   }
 
+  // The switch can be appended by the main script, which has run by now.
+  resource_cache_host_ = ResourceCacheHost::MaybeCreate();
+
 #if !BUILDFLAG(IS_MAC)
   // The corresponding call in macOS is in ElectronApplicationDelegate.
   Browser::Get()->WillFinishLaunching();
@@ -495,6 +523,8 @@ void ElectronBrowserMainParts::WillRunMainMessageLoop(
 }
 
 void ElectronBrowserMainParts::PostCreateMainMessageLoop() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PostCreateMainMessageLoop");
 #if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_MAC)
   std::string app_name = electron::Browser::Get()->GetName();
 #endif
@@ -549,6 +579,9 @@ void ElectronBrowserMainParts::PostCreateMainMessageLoop() {
 }
 
 void ElectronBrowserMainParts::PostMainMessageLoopRun() {
+  main_thread_profiler_.reset();
+  resource_cache_host_.reset();
+
 #if BUILDFLAG(IS_MAC)
   FreeAppDelegate();
 #endif
@@ -620,6 +653,8 @@ void ElectronBrowserMainParts::PreCreateMainMessageLoop() {
 #endif
 
 void ElectronBrowserMainParts::PreCreateMainMessageLoopCommon() {
+  ScopedStartupPhase startup_phase(
+      "ElectronBrowserMainParts::PreCreateMainMessageLoopCommon");
 #if BUILDFLAG(IS_MAC)
   InitializeMainNib();
   RegisterURLHandler();
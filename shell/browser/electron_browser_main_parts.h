@@ -54,7 +54,9 @@ namespace electron {
 class Browser;
 class ElectronBindings;
 class JavascriptEnvironment;
+class MainThreadProfiler;
 class NodeBindings;
+class ResourceCacheHost;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 class ElectronExtensionsClient;
@@ -95,6 +97,10 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
 
   Browser* browser() { return browser_.get(); }
   BrowserProcessImpl* browser_process() { return fake_browser_process_.get(); }
+  // Null unless --resource-cache-dir was passed.
+  ResourceCacheHost* resource_cache_host() {
+    return resource_cache_host_.get();
+  }
 
  protected:
   // content::BrowserMainParts:
@@ -174,6 +180,8 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
 
   std::unique_ptr<IconManager> icon_manager_;
   std::unique_ptr<base::FieldTrialList> field_trial_list_;
+  std::unique_ptr<MainThreadProfiler> main_thread_profiler_;
+  std::unique_ptr<ResourceCacheHost> resource_cache_host_;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   std::unique_ptr<ElectronExtensionsClient> extensions_client_;
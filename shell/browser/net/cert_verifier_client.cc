@@ -4,6 +4,8 @@
 
 #include <utility>
 
+#include "mojo/public/cpp/bindings/callback_helpers.h"
+#include "net/base/net_errors.h"
 #include "net/cert/cert_verify_result.h"
 #include "shell/browser/net/cert_verifier_client.h"
 
@@ -15,11 +17,17 @@ VerifyRequestParams::~VerifyRequestParams() = default;
 
 VerifyRequestParams::VerifyRequestParams(const VerifyRequestParams&) = default;
 
-CertVerifierClient::CertVerifierClient(CertVerifyProc proc)
-    : cert_verify_proc_(proc) {}
+CertVerifierClient::CertVerifierClient(CertVerifyProc proc,
+                                       base::TimeDelta cache_ttl)
+    : cert_verify_proc_(proc), cache_ttl_(cache_ttl) {}
 
 CertVerifierClient::~CertVerifierClient() = default;
 
+void CertVerifierClient::ClearCache() {
+  cache_.Clear();
+  cache_generation_++;
+}
+
 void CertVerifierClient::Verify(
     int default_error,
     const net::CertVerifyResult& default_result,
@@ -28,6 +36,11 @@ void CertVerifierClient::Verify(
     int flags,
     const std::optional<std::string>& ocsp_response,
     VerifyCallback callback) {
+  VerdictCallback respond = base::BindOnce(
+      [](VerifyCallback callback, const net::CertVerifyResult& result,
+         int err) { std::move(callback).Run(err, result); },
+      std::move(callback), default_result);
+
   VerifyRequestParams params;
   params.hostname = hostname;
   params.default_result = net::ErrorToString(default_error);
@@ -35,12 +48,53 @@ void CertVerifierClient::Verify(
   params.certificate = certificate;
   params.validated_certificate = default_result.verified_cert;
   params.is_issued_by_known_root = default_result.is_issued_by_known_root;
+
+  if (!cache_ttl_.is_positive()) {
+    cert_verify_proc_.Run(params, std::move(respond));
+    return;
+  }
+
+  CacheKey key{certificate->CalculateChainFingerprint256(), hostname,
+               default_error};
+  if (auto cached = cache_.Get(key); cached != cache_.end()) {
+    if (base::TimeTicks::Now() < cached->second.expiry) {
+      std::move(respond).Run(cached->second.verdict);
+      return;
+    }
+    cache_.Erase(cached);
+  }
+
+  auto [pending, inserted] = pending_.try_emplace(key);
+  pending->second.push_back(std::move(respond));
+  if (!inserted)
+    return;
+
+  // Other verifications of this certificate wait for this verdict, so fail
+  // them rather than stall all of them if the proc drops its callback. The
+  // failure is cached like any other verdict.
   cert_verify_proc_.Run(
-      params,
-      base::BindOnce(
-          [](VerifyCallback callback, const net::CertVerifyResult& result,
-             int err) { std::move(callback).Run(err, result); },
-          std::move(callback), default_result));
+      params, mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+                  base::BindOnce(&CertVerifierClient::OnVerdict,
+                                 weak_factory_.GetWeakPtr(), std::move(key),
+                                 cache_generation_),
+                  net::ERR_FAILED));
+}
+
+void CertVerifierClient::OnVerdict(const CacheKey& key,
+                                   uint64_t cache_generation,
+                                   int verdict) {
+  if (cache_generation == cache_generation_) {
+    cache_.Put(key,
+               CachedVerdict{verdict, base::TimeTicks::Now() + cache_ttl_});
+  }
+
+  auto pending = pending_.find(key);
+  if (pending == pending_.end())
+    return;
+  std::vector<VerdictCallback> callbacks = std::move(pending->second);
+  pending_.erase(pending);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(verdict);
 }
 
 }  // namespace electron
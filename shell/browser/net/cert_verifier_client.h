@@ -5,8 +5,15 @@
 #ifndef ELECTRON_SHELL_BROWSER_NET_CERT_VERIFIER_CLIENT_H_
 #define ELECTRON_SHELL_BROWSER_NET_CERT_VERIFIER_CLIENT_H_
 
+#include <map>
 #include <string>
+#include <tuple>
+#include <vector>
 
+#include "base/containers/lru_cache.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "net/base/hash_value.h"
 #include "net/cert/x509_certificate.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 
@@ -31,9 +38,22 @@ class CertVerifierClient : public network::mojom::CertVerifierClient {
       base::RepeatingCallback<void(const VerifyRequestParams& request,
                                    base::OnceCallback<void(int)>)>;
 
-  explicit CertVerifierClient(CertVerifyProc proc);
+  static constexpr size_t kMaxCachedVerdicts = 1000;
+
+  // When |cache_ttl| is positive, the verdicts of |proc| are reused for that
+  // long for the same certificate chain, hostname and default result, and
+  // verifications that are waiting for the same verdict share one call.
+  explicit CertVerifierClient(CertVerifyProc proc,
+                              base::TimeDelta cache_ttl = base::TimeDelta());
   ~CertVerifierClient() override;
 
+  // Forgets the cached verdicts, so that |proc| is asked again.
+  void ClearCache();
+
+  base::WeakPtr<CertVerifierClient> GetWeakPtr() {
+    return weak_factory_.GetWeakPtr();
+  }
+
   // network::mojom::CertVerifierClient
   void Verify(int default_error,
               const net::CertVerifyResult& default_result,
@@ -44,7 +64,28 @@ class CertVerifierClient : public network::mojom::CertVerifierClient {
               VerifyCallback callback) override;
 
  private:
+  using CacheKey = std::tuple<net::SHA256HashValue, std::string, int>;
+
+  struct CachedVerdict {
+    int verdict;
+    base::TimeTicks expiry;
+  };
+
+  using VerdictCallback = base::OnceCallback<void(int)>;
+
+  void OnVerdict(const CacheKey& key, uint64_t cache_generation, int verdict);
+
   CertVerifyProc cert_verify_proc_;
+
+  const base::TimeDelta cache_ttl_;
+  base::LRUCache<CacheKey, CachedVerdict> cache_{kMaxCachedVerdicts};
+  // Incremented by ClearCache(), so that verdicts asked for before it are
+  // not cached.
+  uint64_t cache_generation_ = 0;
+  // Verifications waiting for a verdict |cert_verify_proc_| is working on.
+  std::map<CacheKey, std::vector<VerdictCallback>> pending_;
+
+  base::WeakPtrFactory<CertVerifierClient> weak_factory_{this};
 };
 
 }  // namespace electron
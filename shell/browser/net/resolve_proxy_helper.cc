@@ -7,9 +7,11 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/task/sequenced_task_runner.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
+#include "net/base/net_errors.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/proxy_resolution/proxy_info.h"
 #include "services/network/public/mojom/network_context.mojom.h"
@@ -20,41 +22,79 @@ using content::BrowserThread;
 
 namespace electron {
 
+namespace {
+
+// Strips the parts of |url| that the proxy resolver never sees, the same way
+// the network service does before handing URLs to PAC scripts, so that URLs
+// that resolve to the same proxy share a lookup and a cache entry.
+GURL GetLookupURL(const GURL& url) {
+  GURL::Replacements replacements;
+  replacements.ClearUsername();
+  replacements.ClearPassword();
+  replacements.ClearRef();
+  if (url.SchemeIsCryptographic()) {
+    replacements.ClearPath();
+    replacements.ClearQuery();
+  }
+  return url.ReplaceComponents(replacements);
+}
+
+}  // namespace
+
 ResolveProxyHelper::ResolveProxyHelper(ElectronBrowserContext* browser_context)
-    : browser_context_(browser_context) {}
+    : browser_context_(browser_context) {
+  receivers_.set_disconnect_handler(base::BindRepeating(
+      &ResolveProxyHelper::OnLookupDisconnected, base::Unretained(this)));
+}
 
 ResolveProxyHelper::~ResolveProxyHelper() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!owned_self_);
-  DCHECK(!receiver_.is_bound());
   // Clear all pending requests if the ProxyService is still alive.
-  pending_requests_.clear();
+  receivers_.Clear();
+  lookups_.clear();
 }
 
 void ResolveProxyHelper::ResolveProxy(const GURL& url,
                                       ResolveProxyCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  // Enqueue the pending request.
-  pending_requests_.emplace_back(url, std::move(callback));
-
-  // If nothing is in progress, start.
-  if (!receiver_.is_bound()) {
-    DCHECK_EQ(1u, pending_requests_.size());
-    StartPendingRequest();
+  GURL lookup_url = GetLookupURL(url);
+
+  if (auto cached = cache_.Get(lookup_url); cached != cache_.end()) {
+    if (base::TimeTicks::Now() < cached->second.expiry) {
+      // Keep the callback asynchronous, as it is for lookups.
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback), cached->second.proxy));
+      return;
+    }
+    cache_.Erase(cached);
   }
+
+  LookupKey key{cache_generation_, std::move(lookup_url)};
+  auto [lookup, inserted] = lookups_.try_emplace(key);
+  lookup->second.push_back(std::move(callback));
+  if (!inserted)
+    return;
+
+  if (receivers_.size() < kMaxConcurrentLookups)
+    StartLookup(key);
+  else
+    queued_lookups_.push_back(std::move(key));
+}
+
+void ResolveProxyHelper::ClearCache() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  cache_.Clear();
+  cache_generation_++;
 }
 
-void ResolveProxyHelper::StartPendingRequest() {
+void ResolveProxyHelper::StartLookup(const LookupKey& key) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!receiver_.is_bound());
-  DCHECK(!pending_requests_.empty());
-
-  // Start the request.
-  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client =
-      receiver_.BindNewPipeAndPassRemote();
-  receiver_.set_disconnect_handler(
-      base::BindOnce(&ResolveProxyHelper::OnProxyLookupComplete,
-                     base::Unretained(this), net::ERR_ABORTED, std::nullopt));
+  DCHECK_LT(receivers_.size(), kMaxConcurrentLookups);
+
+  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client;
+  receivers_.Add(this, proxy_lookup_client.InitWithNewPipeAndPassReceiver(),
+                 key);
+
   network::mojom::NetworkContext* network_context = nullptr;
   if (browser_context_) {
     network_context =
@@ -64,47 +104,52 @@ void ResolveProxyHelper::StartPendingRequest() {
     network_context = SystemNetworkContextManager::GetInstance()->GetContext();
   }
   CHECK(network_context);
-  network_context->LookUpProxyForURL(pending_requests_.front().url,
-                                     net::NetworkAnonymizationKey(),
+  network_context->LookUpProxyForURL(key.second, net::NetworkAnonymizationKey(),
                                      std::move(proxy_lookup_client));
 }
 
+void ResolveProxyHelper::FinishLookup(const LookupKey& key,
+                                      const std::string& proxy) {
+  auto lookup = lookups_.find(key);
+  DCHECK(lookup != lookups_.end());
+  std::vector<ResolveProxyCallback> callbacks = std::move(lookup->second);
+  lookups_.erase(lookup);
+
+  while (!queued_lookups_.empty() &&
+         receivers_.size() < kMaxConcurrentLookups) {
+    StartLookup(queued_lookups_.front());
+    queued_lookups_.pop_front();
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(proxy);
+}
+
+void ResolveProxyHelper::OnLookupDisconnected() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  // The set has already dropped the receiver.
+  LookupKey key = receivers_.current_context();
+  FinishLookup(key, std::string());
+}
+
 void ResolveProxyHelper::OnProxyLookupComplete(
     int32_t net_error,
     const std::optional<net::ProxyInfo>& proxy_info) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!pending_requests_.empty());
 
-  receiver_.reset();
-
-  // Clear the current (completed) request.
-  PendingRequest completed_request = std::move(pending_requests_.front());
-  pending_requests_.pop_front();
+  LookupKey key = receivers_.current_context();
+  receivers_.Remove(receivers_.current_receiver());
 
   std::string proxy;
   if (proxy_info)
     proxy = proxy_info->ToPacString();
 
-  if (!completed_request.callback.is_null())
-    std::move(completed_request.callback).Run(proxy);
+  if (net_error == net::OK && proxy_info && key.first == cache_generation_) {
+    cache_.Put(key.second,
+               CachedProxy{proxy, base::TimeTicks::Now() + kCacheTTL});
+  }
 
-  // Start the next request.
-  if (!pending_requests_.empty())
-    StartPendingRequest();
+  FinishLookup(key, proxy);
 }
 
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    const GURL& url,
-    ResolveProxyCallback callback)
-    : url(url), callback(std::move(callback)) {}
-
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    ResolveProxyHelper::PendingRequest&& pending_request) noexcept = default;
-
-ResolveProxyHelper::PendingRequest::~PendingRequest() noexcept = default;
-
-ResolveProxyHelper::PendingRequest&
-ResolveProxyHelper::PendingRequest::operator=(
-    ResolveProxyHelper::PendingRequest&& pending_request) noexcept = default;
-
 }  // namespace electron
@@ -6,12 +6,17 @@
 #define ELECTRON_SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 
 #include <deque>
+#include <map>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/ref_counted.h"
-#include "mojo/public/cpp/bindings/receiver.h"
+#include "base/time/time.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 #include "services/network/public/mojom/proxy_lookup_client.mojom.h"
 #include "url/gurl.h"
 
@@ -19,16 +24,32 @@ namespace electron {
 
 class ElectronBrowserContext;
 
+// Resolves proxies for session.resolveProxy() and app.resolveProxy().
+//
+// Lookups for different URLs run in parallel, up to kMaxConcurrentLookups,
+// and lookups for a URL that is already being resolved wait for that lookup
+// instead of starting another one, unless ClearCache() was called since it
+// started. Successful results are reused for kCacheTTL, or until ClearCache()
+// is called.
 class ResolveProxyHelper
     : public base::RefCountedThreadSafe<ResolveProxyHelper>,
       network::mojom::ProxyLookupClient {
  public:
   using ResolveProxyCallback = base::OnceCallback<void(std::string)>;
 
+  static constexpr size_t kMaxConcurrentLookups = 16;
+  static constexpr size_t kMaxCacheSize = 256;
+  static constexpr base::TimeDelta kCacheTTL = base::Seconds(5);
+
   explicit ResolveProxyHelper(ElectronBrowserContext* browser_context);
 
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
 
+  // Forgets the cached results, and makes later calls start new lookups
+  // rather than wait for running ones. Called when the proxy configuration
+  // changes.
+  void ClearCache();
+
   // disable copy
   ResolveProxyHelper(const ResolveProxyHelper&) = delete;
   ResolveProxyHelper& operator=(const ResolveProxyHelper&) = delete;
@@ -38,37 +59,38 @@ class ResolveProxyHelper
 
  private:
   friend class base::RefCountedThreadSafe<ResolveProxyHelper>;
-  // A PendingRequest is a resolve request that is in progress, or queued.
-  struct PendingRequest {
-   public:
-    PendingRequest(const GURL& url, ResolveProxyCallback callback);
-    PendingRequest(PendingRequest&& pending_request) noexcept;
-    ~PendingRequest();
-
-    // disable copy
-    PendingRequest(const PendingRequest&) = delete;
-    PendingRequest& operator=(const PendingRequest&) = delete;
 
-    PendingRequest& operator=(PendingRequest&& pending_request) noexcept;
+  // The value of |cache_generation_| when a lookup was requested, and the
+  // URL it is for. Results of lookups requested before ClearCache() are not
+  // cached, nor shared with calls made after it.
+  using LookupKey = std::pair<uint64_t, GURL>;
 
-    GURL url;
-    ResolveProxyCallback callback;
+  struct CachedProxy {
+    std::string proxy;
+    base::TimeTicks expiry;
   };
 
-  // Starts the first pending request.
-  void StartPendingRequest();
+  void StartLookup(const LookupKey& key);
+
+  // Runs the callbacks waiting for |key| and starts queued lookups.
+  void FinishLookup(const LookupKey& key, const std::string& proxy);
+
+  void OnLookupDisconnected();
 
   // network::mojom::ProxyLookupClient implementation.
   void OnProxyLookupComplete(
       int32_t net_error,
       const std::optional<net::ProxyInfo>& proxy_info) override;
 
-  // Self-reference. Owned as long as there's an outstanding proxy lookup.
-  scoped_refptr<ResolveProxyHelper> owned_self_;
+  // Callbacks waiting for each running or queued lookup.
+  std::map<LookupKey, std::vector<ResolveProxyCallback>> lookups_;
+  // Lookups that wait for a free slot, in the order they were requested.
+  std::deque<LookupKey> queued_lookups_;
+  // One receiver per running lookup.
+  mojo::ReceiverSet<network::mojom::ProxyLookupClient, LookupKey> receivers_;
 
-  std::deque<PendingRequest> pending_requests_;
-  // Receiver for the currently in-progress request, if any.
-  mojo::Receiver<network::mojom::ProxyLookupClient> receiver_{this};
+  base::LRUCache<GURL, CachedProxy> cache_{kMaxCacheSize};
+  uint64_t cache_generation_ = 0;
 
   // Weak Ref
   raw_ptr<ElectronBrowserContext> browser_context_;
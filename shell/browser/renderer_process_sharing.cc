@@ -0,0 +1,81 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/renderer_process_sharing.h"
+
+#include <algorithm>
+
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/web_contents.h"
+#include "shell/browser/web_contents_preferences.h"
+
+namespace electron {
+
+RendererProcessSharing::RendererProcessSharing(size_t max_processes,
+                                               size_t windows_per_process)
+    : max_processes_{max_processes},
+      windows_per_process_{windows_per_process} {}
+
+RendererProcessSharing::~RendererProcessSharing() = default;
+
+content::RenderProcessHost* RendererProcessSharing::PickProcess(
+    content::WebContents* web_contents,
+    const GURL& site_url) {
+  std::vector<Member>& group = GetGroup(GetGroupKey(web_contents, site_url));
+
+  const Member* least_recently_used = nullptr;
+  const Member* least_recently_used_with_room = nullptr;
+  for (const Member& member : group) {
+    if (!least_recently_used ||
+        member.last_used < least_recently_used->last_used) {
+      least_recently_used = &member;
+    }
+    if (WebContentsPreferences::GetWebContentsCountForProcessID(
+            member.process_id) < windows_per_process_ &&
+        (!least_recently_used_with_room ||
+         member.last_used < least_recently_used_with_room->last_used)) {
+      least_recently_used_with_room = &member;
+    }
+  }
+
+  if (least_recently_used_with_room) {
+    return content::RenderProcessHost::FromID(
+        least_recently_used_with_room->process_id);
+  }
+  if (group.size() < max_processes_)
+    return nullptr;
+  return content::RenderProcessHost::FromID(least_recently_used->process_id);
+}
+
+void RendererProcessSharing::DidPickProcess(
+    content::WebContents* web_contents,
+    const GURL& site_url,
+    content::RenderProcessHost* process) {
+  std::vector<Member>& group = GetGroup(GetGroupKey(web_contents, site_url));
+  auto iter = std::ranges::find(group, process->GetID(), &Member::process_id);
+  if (iter != group.end())
+    iter->last_used = base::TimeTicks::Now();
+  else if (group.size() < max_processes_)
+    group.push_back({process->GetID(), base::TimeTicks::Now()});
+}
+
+RendererProcessSharing::GroupKey RendererProcessSharing::GetGroupKey(
+    content::WebContents* web_contents,
+    const GURL& site_url) const {
+  base::CommandLine command_line(base::CommandLine::NO_PROGRAM);
+  if (auto* prefs = WebContentsPreferences::From(web_contents))
+    prefs->AppendCommandLineSwitches(&command_line, false /* is_subframe */);
+  return {site_url, command_line.argv()};
+}
+
+std::vector<RendererProcessSharing::Member>& RendererProcessSharing::GetGroup(
+    const GroupKey& key) {
+  std::vector<Member>& group = groups_[key];
+  std::erase_if(group, [](const Member& member) {
+    return !content::RenderProcessHost::FromID(member.process_id);
+  });
+  return group;
+}
+
+}  // namespace electron
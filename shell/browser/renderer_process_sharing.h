@@ -0,0 +1,72 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_SHARING_H_
+#define ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_SHARING_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/time/time.h"
+#include "url/gurl.h"
+
+namespace content {
+class RenderProcessHost;
+class WebContents;
+}  // namespace content
+
+namespace electron {
+
+// Lets the windows of a session share renderer processes instead of each
+// getting its own. Windows are grouped by site and by the renderer switches
+// their webPreferences produce, since a renderer keeps the switches of the
+// window it was launched for. Within a group, a window joins the least
+// recently used process that hosts fewer than |windows_per_process|
+// windows. If there is none, it gets a new process, unless the group
+// already has |max_processes| processes, in which case it joins the least
+// recently used one regardless of how many windows that process hosts.
+class RendererProcessSharing {
+ public:
+  RendererProcessSharing(size_t max_processes, size_t windows_per_process);
+  ~RendererProcessSharing();
+
+  // disable copy
+  RendererProcessSharing(const RendererProcessSharing&) = delete;
+  RendererProcessSharing& operator=(const RendererProcessSharing&) = delete;
+
+  // Returns the process that the main frame of |web_contents| should use to
+  // load |site_url|, or nullptr if it should get a new one.
+  content::RenderProcessHost* PickProcess(content::WebContents* web_contents,
+                                          const GURL& site_url);
+
+  // Records that the main frame of |web_contents| was given |process| to
+  // load |site_url|.
+  void DidPickProcess(content::WebContents* web_contents,
+                      const GURL& site_url,
+                      content::RenderProcessHost* process);
+
+ private:
+  struct Member {
+    int process_id;
+    base::TimeTicks last_used;
+  };
+
+  using GroupKey = std::pair<GURL, base::CommandLine::StringVector>;
+
+  GroupKey GetGroupKey(content::WebContents* web_contents,
+                       const GURL& site_url) const;
+
+  // Returns the group's processes, without those that are gone.
+  std::vector<Member>& GetGroup(const GroupKey& key);
+
+  const size_t max_processes_;
+  const size_t windows_per_process_;
+  std::map<GroupKey, std::vector<Member>> groups_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_SHARING_H_
@@ -0,0 +1,149 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/resource_cache_host.h"
+
+#include <string>
+#include <utility>
+
+#include "base/command_line.h"
+#include "base/files/file_enumerator.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+#include "build/build_config.h"
+#include "content/public/browser/render_process_host.h"
+#include "electron/electron_version.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "shell/common/api/api.mojom.h"
+#include "shell/common/options_switches.h"
+#include "shell/common/resource_cache.h"
+
+namespace electron {
+
+namespace {
+
+// Returns the directory for the cache files of this version of Electron. The
+// files are named after the hash of the resources they hold, so every app
+// running the same build shares the same file.
+base::FilePath GetVersionDir(const base::FilePath& root_dir) {
+  return root_dir.AppendASCII(ELECTRON_VERSION_STRING);
+}
+
+// Creates |dir| if needed, and makes sure that only the current user can get
+// at it. On Windows the directory inherits the ACL of its parent.
+bool PrepareVersionDir(const base::FilePath& dir) {
+  if (!base::CreateDirectory(dir))
+    return false;
+#if BUILDFLAG(IS_POSIX)
+  // Only the owner may change the permissions, so this also turns down
+  // directories that belong to somebody else.
+  if (!base::SetPosixFilePermissions(dir, base::FILE_PERMISSION_USER_MASK))
+    return false;
+#endif
+  return true;
+}
+
+// Deletes the other cache files of this version of Electron, which hold the
+// resources of another build of it. Running instances that still map one keep
+// reading it on POSIX, and on Windows it cannot be deleted until they are
+// gone, so it is picked up again by a later launch.
+void EvictOtherFiles(const base::FilePath& dir, const base::FilePath& keep) {
+  base::FileEnumerator enumerator(dir, /*recursive=*/false,
+                                  base::FileEnumerator::FILES,
+                                  FILE_PATH_LITERAL("*.resources"));
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (path != keep)
+      base::DeleteFile(path);
+  }
+}
+
+// Attaches the file at |path| to the cache of this process if it is intact.
+base::File OpenAndVerify(const base::FilePath& path) {
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid() ||
+      !ResourceCache::Get()->Attach(file.Duplicate(),
+                                    /*verify_checksum=*/true)) {
+    return {};
+  }
+  return file;
+}
+
+base::File OpenOrBuild(const base::FilePath& dir) {
+  if (!PrepareVersionDir(dir))
+    return {};
+
+  const base::FilePath path = dir.AppendASCII(ResourceCache::GetFileName());
+  base::File file = OpenAndVerify(path);
+  if (!file.IsValid()) {
+    // Write to a temporary file first, so that other instances never map a
+    // partially written file.
+    base::FilePath temp_path;
+    if (!base::CreateTemporaryFileInDir(dir, &temp_path))
+      return {};
+    if (!ResourceCache::Write(temp_path) ||
+        !base::ReplaceFile(temp_path, path, nullptr)) {
+      base::DeleteFile(temp_path);
+      return {};
+    }
+    file = OpenAndVerify(path);
+    if (!file.IsValid())
+      return {};
+  }
+
+  EvictOtherFiles(dir, path);
+  return file;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<ResourceCacheHost> ResourceCacheHost::MaybeCreate() {
+  const base::FilePath root_dir =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValuePath(
+          switches::kResourceCacheDir);
+  if (!root_dir.IsAbsolute())
+    return nullptr;
+  return std::make_unique<ResourceCacheHost>(root_dir);
+}
+
+ResourceCacheHost::ResourceCacheHost(const base::FilePath& root_dir) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&OpenOrBuild, GetVersionDir(root_dir)),
+      base::BindOnce(&ResourceCacheHost::OnFileReady,
+                     weak_factory_.GetWeakPtr()));
+}
+
+ResourceCacheHost::~ResourceCacheHost() = default;
+
+void ResourceCacheHost::RenderProcessWillLaunch(
+    content::RenderProcessHost* host) {
+  if (file_.IsValid())
+    SendFile(host);
+}
+
+void ResourceCacheHost::OnFileReady(base::File file) {
+  if (!file.IsValid())
+    return;
+  file_ = std::move(file);
+  for (auto it = content::RenderProcessHost::AllHostsIterator(); !it.IsAtEnd();
+       it.Advance()) {
+    if (it.GetCurrentValue()->IsInitializedAndNotDead())
+      SendFile(it.GetCurrentValue());
+  }
+}
+
+void ResourceCacheHost::SendFile(content::RenderProcessHost* host) {
+  // The message is delivered even though the remote goes away right after.
+  mojo::Remote<mojom::ElectronResourceCache> resource_cache;
+  host->BindReceiver(resource_cache.BindNewPipeAndPassReceiver());
+  resource_cache->Attach(file_.Duplicate());
+}
+
+}  // namespace electron
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_RESOURCE_CACHE_HOST_H_
+#define ELECTRON_SHELL_BROWSER_RESOURCE_CACHE_HOST_H_
+
+#include <memory>
+
+#include "base/files/file.h"
+#include "base/memory/weak_ptr.h"
+
+namespace base {
+class FilePath;
+}
+
+namespace content {
+class RenderProcessHost;
+}
+
+namespace electron {
+
+// Opens the resource cache of this build of Electron, or builds it if it does
+// not exist yet, in a directory of this version under the path passed with
+// --resource-cache-dir, then hands it to every renderer process. Apps running
+// the same build share the file. Sandboxed renderers cannot open files
+// themselves, so they get a read-only handle.
+class ResourceCacheHost {
+ public:
+  // Returns nullptr unless an absolute --resource-cache-dir was passed.
+  static std::unique_ptr<ResourceCacheHost> MaybeCreate();
+
+  explicit ResourceCacheHost(const base::FilePath& root_dir);
+  ~ResourceCacheHost();
+
+  // disable copy
+  ResourceCacheHost(const ResourceCacheHost&) = delete;
+  ResourceCacheHost& operator=(const ResourceCacheHost&) = delete;
+
+  void RenderProcessWillLaunch(content::RenderProcessHost* host);
+
+ private:
+  void OnFileReady(base::File file);
+  void SendFile(content::RenderProcessHost* host);
+
+  // Invalid until the cache has been opened and verified.
+  base::File file_;
+
+  base::WeakPtrFactory<ResourceCacheHost> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_RESOURCE_CACHE_HOST_H_
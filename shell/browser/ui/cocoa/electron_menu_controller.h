@@ -54,6 +54,12 @@ class ElectronMenuModel;
 - (NSMenuItem*)makeMenuItemForIndex:(NSInteger)index
                           fromModel:(electron::ElectronMenuModel*)model;
 
+// Updates the title, icon, tool tip and, for submenus, the enabled state of
+// the item at |index| of the menu from the model. Items are otherwise only
+// updated when they are validated, which never happens to the submenus shown
+// in the menu bar.
+- (void)refreshItemAtIndex:(NSInteger)index;
+
 // Whether the menu is currently open.
 - (BOOL)isMenuOpen;
 
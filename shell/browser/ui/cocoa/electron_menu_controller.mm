@@ -442,6 +442,32 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
            atIndex:index];
 }
 
+// Updates the properties of |item| that menu.updateMenuItem() can change in
+// place from the item at |index| in |model|.
+- (void)refreshItem:(NSMenuItem*)item
+            atIndex:(NSInteger)index
+          fromModel:(electron::ElectronMenuModel*)model {
+  NSString* label = l10n_util::FixUpWindowsStyleLabel(model->GetLabelAt(index));
+  if (![[item title] isEqualToString:label]) {
+    [item setTitle:label];
+    // The menu bar shows the title of the submenu rather than of the item.
+    [[item submenu] setTitle:label];
+  }
+  ui::ImageModel icon = model->GetIconAt(index);
+  [item setImage:(icon.IsImage() ? icon.GetImage().ToNSImage() : nil)];
+  [item setToolTip:base::SysUTF16ToNSString(model->GetToolTipAt(index))];
+}
+
+- (void)refreshItemAtIndex:(NSInteger)index {
+  if (!menu_ || !model_ || index >= [menu_ numberOfItems])
+    return;
+  NSMenuItem* item = [menu_ itemAtIndex:index];
+  [self refreshItem:item atIndex:index fromModel:model_.get()];
+  // Submenus are not validated either, see makeMenuItemForIndex.
+  if ([item hasSubmenu])
+    [item setEnabled:model_->IsEnabledAt(index)];
+}
+
 // Called before the menu is to be displayed to update the state (enabled,
 // radio, etc) of each item in the menu.
 - (BOOL)validateUserInterfaceItem:(id<NSValidatedUserInterfaceItem>)item {
@@ -463,6 +489,8 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
         setState:(checked ? NSControlStateValueOn : NSControlStateValueOff)];
     [(id)item setHidden:(!model->IsVisibleAt(modelIndex))];
 
+    [self refreshItem:(NSMenuItem*)item atIndex:modelIndex fromModel:model];
+
     return model->IsEnabledAt(modelIndex);
   }
   return NO;
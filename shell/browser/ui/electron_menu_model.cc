@@ -86,6 +86,12 @@ bool ElectronMenuModel::WorksWhenHiddenAt(size_t index) const {
   return true;
 }
 
+void ElectronMenuModel::ItemChangedAt(size_t index) {
+  for (Observer& observer : observers_) {
+    observer.OnMenuItemChanged(this, index);
+  }
+}
+
 #if BUILDFLAG(IS_MAC)
 bool ElectronMenuModel::GetSharingItemAt(size_t index,
                                          SharingItem* item) const {
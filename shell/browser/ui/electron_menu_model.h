@@ -70,6 +70,10 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
 
     // Notifies the menu has been closed.
     virtual void OnMenuWillClose() {}
+
+    // Notifies the properties of the item at |index| in |model| have been
+    // changed in place.
+    virtual void OnMenuItemChanged(ElectronMenuModel* model, size_t index) {}
   };
 
   explicit ElectronMenuModel(Delegate* delegate);
@@ -93,6 +97,9 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
                                   ui::Accelerator* accelerator) const;
   bool ShouldRegisterAcceleratorAt(size_t index) const;
   bool WorksWhenHiddenAt(size_t index) const;
+  // Tells the observers that the item at |index| has been changed, so that
+  // the platform menus can update just that item instead of being rebuilt.
+  void ItemChangedAt(size_t index);
 #if BUILDFLAG(IS_MAC)
   // Return the SharingItem of menu item.
   bool GetSharingItemAt(size_t index, SharingItem* item) const;
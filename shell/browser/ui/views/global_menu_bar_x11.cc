@@ -161,6 +161,15 @@ void SetMenuItemID(DbusmenuMenuitem* item, int id) {
   g_object_set_data(G_OBJECT(item), "menu-id", GINT_TO_POINTER(id + 1));
 }
 
+ElectronMenuModel::ItemType GetMenuItemType(DbusmenuMenuitem* item) {
+  return static_cast<ElectronMenuModel::ItemType>(
+      GPOINTER_TO_INT(g_object_get_data(G_OBJECT(item), "menu-type")) - 1);
+}
+
+void SetMenuItemType(DbusmenuMenuitem* item, ElectronMenuModel::ItemType type) {
+  g_object_set_data(G_OBJECT(item), "menu-type", GINT_TO_POINTER(type + 1));
+}
+
 std::string GetMenuModelStatus(ElectronMenuModel* model) {
   std::string ret;
   for (size_t i = 0; i < model->GetItemCount(); ++i) {
@@ -187,6 +196,7 @@ GlobalMenuBarX11::GlobalMenuBarX11(NativeWindowViews* window)
 }
 
 GlobalMenuBarX11::~GlobalMenuBarX11() {
+  StopObservingModels();
   if (IsServerStarted())
     g_object_unref(server_);
 
@@ -203,6 +213,8 @@ void GlobalMenuBarX11::SetMenu(ElectronMenuModel* menu_model) {
   if (!IsServerStarted())
     return;
 
+  StopObservingModels();
+
   DbusmenuMenuitem* root_item = menuitem_new();
   menuitem_property_set(root_item, kPropertyLabel, "Root");
   menuitem_property_set_bool(root_item, kPropertyVisible, true);
@@ -211,6 +223,7 @@ void GlobalMenuBarX11::SetMenu(ElectronMenuModel* menu_model) {
   }
 
   server_set_root(server_, root_item);
+  root_item_ = root_item;
   g_object_unref(root_item);
 }
 
@@ -240,49 +253,130 @@ void GlobalMenuBarX11::BuildMenuFromModel(ElectronMenuModel* model,
         sender, detailed_signal,
         base::BindRepeating(receiver, base::Unretained(this)));
   };
+  ObserveModel(model);
   for (size_t i = 0; i < model->GetItemCount(); ++i) {
     DbusmenuMenuitem* item = menuitem_new();
-    menuitem_property_set_bool(item, kPropertyVisible, model->IsVisibleAt(i));
+    g_object_set_data(G_OBJECT(item), "model", model);
+    SetMenuItemID(item, i);
+    items_[{model, i}] = item;
 
     ElectronMenuModel::ItemType type = model->GetTypeAt(i);
+    SetMenuItemType(item, type);
     if (type == ElectronMenuModel::TYPE_SEPARATOR) {
       menuitem_property_set(item, kPropertyType, kTypeSeparator);
+    } else if (type == ElectronMenuModel::TYPE_SUBMENU) {
+      menuitem_property_set(item, kPropertyChildrenDisplay, kDisplaySubmenu);
+      connect(item, "about-to-show", &GlobalMenuBarX11::OnSubMenuShow);
     } else {
-      std::string label = ui::ConvertAcceleratorsFromWindowsStyle(
-          base::UTF16ToUTF8(model->GetLabelAt(i)));
-      menuitem_property_set(item, kPropertyLabel, label.c_str());
-      menuitem_property_set_bool(item, kPropertyEnabled, model->IsEnabledAt(i));
-
-      g_object_set_data(G_OBJECT(item), "model", model);
-      SetMenuItemID(item, i);
-
-      if (type == ElectronMenuModel::TYPE_SUBMENU) {
-        menuitem_property_set(item, kPropertyChildrenDisplay, kDisplaySubmenu);
-        connect(item, "about-to-show", &GlobalMenuBarX11::OnSubMenuShow);
-      } else {
-        ui::Accelerator accelerator;
-        if (model->GetAcceleratorAtWithParams(i, true, &accelerator))
-          RegisterAccelerator(item, accelerator);
-
-        connect(item, "item-activated", &GlobalMenuBarX11::OnItemActivated);
-
-        if (type == ElectronMenuModel::TYPE_CHECK ||
-            type == ElectronMenuModel::TYPE_RADIO) {
-          menuitem_property_set(item, kPropertyToggleType,
-                                type == ElectronMenuModel::TYPE_CHECK
-                                    ? kToggleCheck
-                                    : kToggleRadio);
-          menuitem_property_set_int(item, kPropertyToggleState,
-                                    model->IsItemCheckedAt(i));
-        }
+      ui::Accelerator accelerator;
+      if (model->GetAcceleratorAtWithParams(i, true, &accelerator))
+        RegisterAccelerator(item, accelerator);
+
+      connect(item, "item-activated", &GlobalMenuBarX11::OnItemActivated);
+
+      if (type == ElectronMenuModel::TYPE_CHECK ||
+          type == ElectronMenuModel::TYPE_RADIO) {
+        menuitem_property_set(item, kPropertyToggleType,
+                              type == ElectronMenuModel::TYPE_CHECK
+                                  ? kToggleCheck
+                                  : kToggleRadio);
       }
     }
+    UpdateMenuItem(model, i, item);
 
     menuitem_child_append(parent, item);
     g_object_unref(item);
   }
 }
 
+bool GlobalMenuBarX11::UpdateMenuFromModel(ElectronMenuModel* model,
+                                           DbusmenuMenuitem* parent) {
+  GList* children = menuitem_get_children(parent);
+  if (g_list_length(children) != model->GetItemCount())
+    return false;
+
+  size_t i = 0;
+  for (GList* l = children; l; l = l->next, ++i) {
+    auto* item = static_cast<DbusmenuMenuitem*>(l->data);
+    size_t id;
+    if (ModelForMenuItem(item) != model || !GetMenuItemID(item, &id) ||
+        id != i || GetMenuItemType(item) != model->GetTypeAt(i))
+      return false;
+  }
+
+  // Properties that keep their value are not sent over D-Bus again.
+  i = 0;
+  for (GList* l = children; l; l = l->next, ++i)
+    UpdateMenuItem(model, i, static_cast<DbusmenuMenuitem*>(l->data));
+  return true;
+}
+
+void GlobalMenuBarX11::UpdateMenuItem(ElectronMenuModel* model,
+                                      size_t index,
+                                      DbusmenuMenuitem* item) {
+  menuitem_property_set_bool(item, kPropertyVisible, model->IsVisibleAt(index));
+
+  ElectronMenuModel::ItemType type = model->GetTypeAt(index);
+  if (type == ElectronMenuModel::TYPE_SEPARATOR)
+    return;
+
+  std::string label = ui::ConvertAcceleratorsFromWindowsStyle(
+      base::UTF16ToUTF8(model->GetLabelAt(index)));
+  menuitem_property_set(item, kPropertyLabel, label.c_str());
+  menuitem_property_set_bool(item, kPropertyEnabled, model->IsEnabledAt(index));
+
+  if (type == ElectronMenuModel::TYPE_CHECK ||
+      type == ElectronMenuModel::TYPE_RADIO) {
+    menuitem_property_set_int(item, kPropertyToggleState,
+                              model->IsItemCheckedAt(index));
+  }
+}
+
+void GlobalMenuBarX11::ForgetMenuItems(DbusmenuMenuitem* parent) {
+  for (GList* l = menuitem_get_children(parent); l; l = l->next) {
+    auto* item = static_cast<DbusmenuMenuitem*>(l->data);
+    size_t id;
+    if (GetMenuItemID(item, &id)) {
+      auto it = items_.find({ModelForMenuItem(item), id});
+      if (it != items_.end() && it->second == item)
+        items_.erase(it);
+    }
+    ForgetMenuItems(item);
+  }
+}
+
+void GlobalMenuBarX11::ObserveModel(ElectronMenuModel* model) {
+  base::WeakPtr<ElectronMenuModel>& observed = observed_models_[model];
+  if (observed)
+    return;
+  observed = model->GetWeakPtr();
+  model->AddObserver(this);
+}
+
+void GlobalMenuBarX11::StopObservingModels() {
+  for (auto& [model, observed] : observed_models_) {
+    if (observed)
+      observed->RemoveObserver(this);
+  }
+  observed_models_.clear();
+  items_.clear();
+  root_item_ = nullptr;
+}
+
+void GlobalMenuBarX11::OnMenuItemChanged(ElectronMenuModel* model,
+                                         size_t index) {
+  if (!root_item_ || index >= model->GetItemCount())
+    return;
+
+  // Items of submenus that have not been shown yet are built when they are.
+  auto it = items_.find({model, index});
+  if (it == items_.end())
+    return;
+  DbusmenuMenuitem* item = it->second;
+  if (GetMenuItemType(item) == model->GetTypeAt(index))
+    UpdateMenuItem(model, index, item);
+}
+
 void GlobalMenuBarX11::RegisterAccelerator(DbusmenuMenuitem* item,
                                            const ui::Accelerator& accelerator) {
   // A translation of libdbusmenu-gtk's menuitem_property_set_shortcut()
@@ -338,13 +432,19 @@ void GlobalMenuBarX11::OnSubMenuShow(DbusmenuMenuitem* item) {
   g_object_set_data_full(G_OBJECT(item), "status", g_strdup(status.c_str()),
                          g_free);
 
+  // Update the items in place if only their labels or states have changed.
+  ElectronMenuModel* submenu = model->GetSubmenuModelAt(id);
+  if (UpdateMenuFromModel(submenu, item))
+    return;
+
   // Clear children.
+  ForgetMenuItems(item);
   GList* children = menuitem_take_children(item);
   g_list_foreach(children, reinterpret_cast<GFunc>(g_object_unref), nullptr);
   g_list_free(children);
 
   // Build children.
-  BuildMenuFromModel(model->GetSubmenuModelAt(id), item);
+  BuildMenuFromModel(submenu, item);
 }
 
 }  // namespace electron
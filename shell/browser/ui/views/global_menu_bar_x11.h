@@ -5,9 +5,13 @@
 #ifndef ELECTRON_SHELL_BROWSER_UI_VIEWS_GLOBAL_MENU_BAR_X11_H_
 #define ELECTRON_SHELL_BROWSER_UI_VIEWS_GLOBAL_MENU_BAR_X11_H_
 
+#include <map>
 #include <string>
+#include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "shell/browser/ui/electron_menu_model.h"
 #include "ui/base/glib/scoped_gsignal.h"
 #include "ui/gfx/native_widget_types.h"
@@ -35,10 +39,10 @@ class NativeWindowViews;
 //
 // This class is like the chrome's corresponding one, but it generates the menu
 // from menu models instead, and it is also per-window specific.
-class GlobalMenuBarX11 {
+class GlobalMenuBarX11 : private ElectronMenuModel::Observer {
  public:
   explicit GlobalMenuBarX11(NativeWindowViews* window);
-  virtual ~GlobalMenuBarX11();
+  ~GlobalMenuBarX11() override;
 
   // disable copy
   GlobalMenuBarX11(const GlobalMenuBarX11&) = delete;
@@ -55,12 +59,31 @@ class GlobalMenuBarX11 {
   void OnWindowUnmapped();
 
  private:
+  // ElectronMenuModel::Observer:
+  void OnMenuItemChanged(ElectronMenuModel* model, size_t index) override;
+
   // Creates a DbusmenuServer.
   void InitServer(x11::Window window);
 
   // Create a menu from menu model.
   void BuildMenuFromModel(ElectronMenuModel* model, DbusmenuMenuitem* parent);
 
+  // Updates the children of |parent| in place from |model|, returns false if
+  // the items of |model| have been added, removed or reordered since they
+  // were built.
+  bool UpdateMenuFromModel(ElectronMenuModel* model, DbusmenuMenuitem* parent);
+
+  // Copies the label and the state of the item at |index| to |item|.
+  void UpdateMenuItem(ElectronMenuModel* model,
+                      size_t index,
+                      DbusmenuMenuitem* item);
+
+  // Forgets the descendants of |parent|, before they are destroyed.
+  void ForgetMenuItems(DbusmenuMenuitem* parent);
+
+  void ObserveModel(ElectronMenuModel* model);
+  void StopObservingModels();
+
   // Sets the accelerator for |item|.
   void RegisterAccelerator(DbusmenuMenuitem* item,
                            const ui::Accelerator& accelerator);
@@ -72,7 +95,17 @@ class GlobalMenuBarX11 {
   x11::Window xwindow_;
 
   raw_ptr<DbusmenuServer> server_ = nullptr;
+  raw_ptr<DbusmenuMenuitem> root_item_ = nullptr;  // owned by |server_|
   std::vector<ScopedGSignal> signals_;
+
+  // The models that items have been built from.
+  base::flat_map<ElectronMenuModel*, base::WeakPtr<ElectronMenuModel>>
+      observed_models_;
+
+  // The items that have been built, by the model and the index in it that
+  // they have been built from.
+  std::map<std::pair<ElectronMenuModel*, size_t>, raw_ptr<DbusmenuMenuitem>>
+      items_;
 };
 
 }  // namespace electron
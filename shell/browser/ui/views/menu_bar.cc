@@ -45,10 +45,20 @@ MenuBar::MenuBar(NativeWindow* window, RootView* root_view)
 }
 
 MenuBar::~MenuBar() {
+  if (observed_model_)
+    observed_model_->RemoveObserver(this);
   window_->RemoveObserver(this);
 }
 
 void MenuBar::SetMenu(ElectronMenuModel* model) {
+  if (observed_model_)
+    observed_model_->RemoveObserver(this);
+  observed_model_.reset();
+  if (model) {
+    model->AddObserver(this);
+    observed_model_ = model->GetWeakPtr();
+  }
+
   menu_model_ = model;
   RebuildChildren();
 }
@@ -62,7 +72,9 @@ MenuBar::View* MenuBar::FindAccelChild(char16_t key) {
   if (key == 0)
     return nullptr;
   for (views::View* child : GetChildrenInZOrder()) {
-    if (static_cast<SubmenuButton*>(child)->accelerator() == key)
+    // Hidden and disabled menus cannot be opened with their accelerator.
+    if (child->GetVisible() && child->GetEnabled() &&
+        static_cast<SubmenuButton*>(child)->accelerator() == key)
       return child;
   }
   return nullptr;
@@ -112,6 +124,21 @@ void MenuBar::OnMenuClosed() {
   SetAcceleratorVisibility(pane_has_focus());
 }
 
+void MenuBar::OnMenuItemChanged(ElectronMenuModel* model, size_t index) {
+  // The submenus read their items from the model whenever they are shown.
+  if (model != menu_model_)
+    return;
+  for (views::View* child : children()) {
+    if (child->GetID() >= 0 && static_cast<size_t>(child->GetID()) == index) {
+      auto* button = static_cast<SubmenuButton*>(child);
+      button->SetTitle(model->GetLabelAt(index));
+      button->SetEnabled(model->IsEnabledAt(index));
+      button->SetVisible(model->IsVisibleAt(index));
+      break;
+    }
+  }
+}
+
 void MenuBar::OnWindowBlur() {
   UpdateViewColors();
   SetAcceleratorVisibility(pane_has_focus());
@@ -231,6 +258,8 @@ void MenuBar::RebuildChildren() {
         base::BindRepeating(&MenuBar::ButtonPressed, base::Unretained(this), i),
         menu_model_->GetLabelAt(i), background_color_);
     button->SetID(i);
+    button->SetEnabled(menu_model_->IsEnabledAt(i));
+    button->SetVisible(menu_model_->IsVisibleAt(i));
     AddChildView(button);
   }
   UpdateViewColors();
@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_BROWSER_UI_VIEWS_MENU_BAR_H_
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "shell/browser/native_window_observer.h"
 #include "shell/browser/ui/electron_menu_model.h"
 #include "shell/browser/ui/views/menu_delegate.h"
@@ -22,6 +23,7 @@ namespace electron {
 
 class MenuBar : public views::AccessiblePaneView,
                 private MenuDelegate::Observer,
+                private ElectronMenuModel::Observer,
                 private NativeWindowObserver {
   METADATA_HEADER(MenuBar, views::AccessiblePaneView)
 
@@ -61,6 +63,9 @@ class MenuBar : public views::AccessiblePaneView,
   void OnBeforeExecuteCommand() override;
   void OnMenuClosed() override;
 
+  // ElectronMenuModel::Observer:
+  void OnMenuItemChanged(ElectronMenuModel* model, size_t index) override;
+
   // NativeWindowObserver:
   void OnWindowBlur() override;
   void OnWindowFocus() override;
@@ -92,6 +97,7 @@ class MenuBar : public views::AccessiblePaneView,
   raw_ptr<NativeWindow> window_;
   raw_ptr<RootView> root_view_;
   raw_ptr<ElectronMenuModel> menu_model_ = nullptr;
+  base::WeakPtr<ElectronMenuModel> observed_model_;
   bool accelerator_installed_ = false;
 };
 
@@ -27,10 +27,7 @@ SubmenuButton::SubmenuButton(PressedCallback callback,
   SetBorder(CreateDefaultBorder());
 #endif
 
-  if (GetUnderlinePosition(title, &accelerator_, &underline_start_,
-                           &underline_end_))
-    gfx::Canvas::SizeStringInt(GetText(), gfx::FontList(), &text_width_,
-                               &text_height_, 0, 0);
+  UpdateAccelerator(title);
 
   views::InkDropHost* ink_drop = views::InkDrop::Get(this);
   ink_drop->SetMode(views::InkDropHost::InkDropMode::ON);
@@ -41,6 +38,12 @@ SubmenuButton::SubmenuButton(PressedCallback callback,
 
 SubmenuButton::~SubmenuButton() = default;
 
+void SubmenuButton::SetTitle(const std::u16string& title) {
+  SetText(gfx::RemoveAccelerator(title));
+  UpdateAccelerator(title);
+  SchedulePaint();
+}
+
 void SubmenuButton::SetAcceleratorVisibility(bool visible) {
   if (visible == show_underline_)
     return;
@@ -71,6 +74,15 @@ void SubmenuButton::PaintButtonContents(gfx::Canvas* canvas) {
   }
 }
 
+void SubmenuButton::UpdateAccelerator(const std::u16string& title) {
+  accelerator_ = 0;
+  underline_start_ = underline_end_ = 0;
+  if (GetUnderlinePosition(title, &accelerator_, &underline_start_,
+                           &underline_end_))
+    gfx::Canvas::SizeStringInt(GetText(), gfx::FontList(), &text_width_,
+                               &text_height_, 0, 0);
+}
+
 bool SubmenuButton::GetUnderlinePosition(const std::u16string& text,
                                          char16_t* accelerator,
                                          int* start,
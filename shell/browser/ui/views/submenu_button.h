@@ -31,6 +31,9 @@ class SubmenuButton : public views::MenuButton {
   SubmenuButton(const SubmenuButton&) = delete;
   SubmenuButton& operator=(const SubmenuButton&) = delete;
 
+  // Replaces the title, including its accelerator.
+  void SetTitle(const std::u16string& title);
+
   void SetAcceleratorVisibility(bool visible);
   void SetUnderlineColor(SkColor color);
 
@@ -42,6 +45,7 @@ class SubmenuButton : public views::MenuButton {
   void PaintButtonContents(gfx::Canvas* canvas) override;
 
  private:
+  void UpdateAccelerator(const std::u16string& title);
   bool GetUnderlinePosition(const std::u16string& text,
                             char16_t* accelerator,
                             int* start,
@@ -0,0 +1,148 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/warm_renderer_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/task/single_thread_task_runner.h"
+#include "content/public/browser/browser_thread.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/web_contents.h"
+#include "shell/browser/electron_browser_context.h"
+#include "shell/browser/javascript_environment.h"
+#include "shell/browser/web_contents_preferences.h"
+#include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+
+namespace electron {
+
+namespace {
+
+void ApplyWebPreferences(content::WebContents* web_contents,
+                         const gin_helper::Dictionary& web_preferences) {
+  if (auto* prefs = WebContentsPreferences::From(web_contents))
+    prefs->SetFromDictionary(web_preferences);
+  else
+    new WebContentsPreferences(web_contents, web_preferences);
+}
+
+void ApplyWebPreferences(content::WebContents* web_contents,
+                         const base::Value::Dict& web_preferences) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  ApplyWebPreferences(
+      web_contents,
+      gin_helper::Dictionary(
+          isolate,
+          gin::ConvertToV8(isolate, web_preferences).As<v8::Object>()));
+}
+
+bool HasLiveRenderer(content::WebContents* web_contents) {
+  return web_contents->GetPrimaryMainFrame()
+      ->GetProcess()
+      ->IsInitializedAndNotDead();
+}
+
+}  // namespace
+
+WarmRendererPool::Spare::Spare() = default;
+WarmRendererPool::Spare::Spare(Spare&&) = default;
+WarmRendererPool::Spare& WarmRendererPool::Spare::operator=(Spare&&) = default;
+WarmRendererPool::Spare::~Spare() = default;
+
+WarmRendererPool::WarmRendererPool(ElectronBrowserContext* browser_context,
+                                   size_t size,
+                                   base::Value::Dict web_preferences)
+    : browser_context_{browser_context},
+      size_{size},
+      web_preferences_{std::move(web_preferences)} {
+  ScheduleRefill();
+}
+
+WarmRendererPool::~WarmRendererPool() = default;
+
+std::unique_ptr<content::WebContents> WarmRendererPool::Claim(
+    const gin_helper::Dictionary& web_preferences) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  // Renderers that crashed while waiting are of no use anymore.
+  std::erase_if(spares_, [](const Spare& spare) {
+    return !HasLiveRenderer(spare.web_contents.get());
+  });
+  ScheduleRefill();
+  if (spares_.empty())
+    return nullptr;
+
+  // The preferences that only affect the page are picked up on navigation,
+  // but those baked into the renderer's command line must match exactly.
+  // They are worked out on a WebContents that never launches a renderer, so
+  // that no spare is touched unless it can be handed out.
+  if (!probe_) {
+    content::WebContents::CreateParams params(browser_context_);
+    params.initially_hidden = true;
+    probe_ = content::WebContents::Create(params);
+  }
+  ApplyWebPreferences(probe_.get(), web_preferences);
+  const base::CommandLine::StringVector switches = GetSwitches(probe_.get());
+
+  auto iter = std::ranges::find(spares_, switches, &Spare::switches);
+  if (iter == spares_.end())
+    return nullptr;
+
+  std::unique_ptr<content::WebContents> web_contents =
+      std::move(iter->web_contents);
+  spares_.erase(iter);
+  WebContentsPreferences::From(web_contents.get())
+      ->SetFromDictionary(web_preferences);
+  return web_contents;
+}
+
+void WarmRendererPool::ScheduleRefill() {
+  if (refill_pending_ || spares_.size() >= size_)
+    return;
+
+  refill_pending_ = true;
+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&WarmRendererPool::Refill,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void WarmRendererPool::Refill() {
+  refill_pending_ = false;
+  if (spares_.size() >= size_)
+    return;
+
+  // Launch one renderer per task so that refilling a large pool does not
+  // block the UI thread for long.
+  spares_.push_back(CreateSpare());
+  ScheduleRefill();
+}
+
+WarmRendererPool::Spare WarmRendererPool::CreateSpare() {
+  content::WebContents::CreateParams params(browser_context_);
+  params.initially_hidden = true;
+  Spare spare;
+  spare.web_contents = content::WebContents::Create(params);
+
+  // The preferences must be attached before the renderer is launched, since
+  // ElectronBrowserClient derives the renderer's switches from them.
+  ApplyWebPreferences(spare.web_contents.get(), web_preferences_);
+  spare.web_contents->GetPrimaryMainFrame()->GetProcess()->Init();
+  spare.switches = GetSwitches(spare.web_contents.get());
+  return spare;
+}
+
+base::CommandLine::StringVector WarmRendererPool::GetSwitches(
+    content::WebContents* web_contents) const {
+  base::CommandLine command_line(base::CommandLine::NO_PROGRAM);
+  WebContentsPreferences::From(web_contents)
+      ->AppendCommandLineSwitches(&command_line, false /* is_subframe */);
+  return command_line.argv();
+}
+
+}  // namespace electron
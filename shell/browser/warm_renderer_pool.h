@@ -0,0 +1,88 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_WARM_RENDERER_POOL_H_
+#define ELECTRON_SHELL_BROWSER_WARM_RENDERER_POOL_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/values.h"
+
+namespace content {
+class WebContents;
+}
+
+namespace gin_helper {
+class Dictionary;
+}
+
+namespace electron {
+
+class ElectronBrowserContext;
+
+// Keeps a number of hidden WebContents around whose renderer process has
+// already been launched and initialized, so that creating a new window can
+// skip process launch and renderer bootstrap. The renderers are launched
+// with the switches derived from the pool's webPreferences, and are only
+// handed out to WebContents whose preferences would have launched an
+// identical renderer. Claimed entries are replaced in the background. The
+// pool is owned by the browser context its WebContents belong to.
+class WarmRendererPool {
+ public:
+  WarmRendererPool(ElectronBrowserContext* browser_context,
+                   size_t size,
+                   base::Value::Dict web_preferences);
+  ~WarmRendererPool();
+
+  // disable copy
+  WarmRendererPool(const WarmRendererPool&) = delete;
+  WarmRendererPool& operator=(const WarmRendererPool&) = delete;
+
+  // Returns a WebContents with a live renderer whose preferences have been
+  // replaced with |web_preferences|, or nullptr if no compatible renderer is
+  // available.
+  std::unique_ptr<content::WebContents> Claim(
+      const gin_helper::Dictionary& web_preferences);
+
+  size_t size() const { return size_; }
+  size_t available() const { return spares_.size(); }
+
+ private:
+  struct Spare {
+    Spare();
+    Spare(Spare&&);
+    Spare& operator=(Spare&&);
+    ~Spare();
+
+    std::unique_ptr<content::WebContents> web_contents;
+    // The switches the renderer was launched with.
+    base::CommandLine::StringVector switches;
+  };
+
+  void ScheduleRefill();
+  void Refill();
+  Spare CreateSpare();
+
+  // The switches a renderer launched for |web_contents| would get.
+  base::CommandLine::StringVector GetSwitches(
+      content::WebContents* web_contents) const;
+
+  raw_ptr<ElectronBrowserContext> browser_context_;
+  const size_t size_;
+  const base::Value::Dict web_preferences_;
+  std::vector<Spare> spares_;
+  // Never launches a renderer, holds the preferences being claimed with.
+  std::unique_ptr<content::WebContents> probe_;
+  bool refill_pending_ = false;
+
+  base::WeakPtrFactory<WarmRendererPool> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_WARM_RENDERER_POOL_H_
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -23,6 +24,7 @@
 #include "shell/browser/native_window.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/common/color_util.h"
+#include "shell/common/gin_converters/struct_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/options_switches.h"
@@ -161,51 +163,60 @@ void WebContentsPreferences::SetFromDictionary(
     const gin_helper::Dictionary& web_preferences) {
   Clear();
 
-  web_preferences.Get(options::kPlugins, &plugins_);
-  web_preferences.Get(options::kExperimentalFeatures, &experimental_features_);
-  web_preferences.Get(options::kNodeIntegration, &node_integration_);
-  web_preferences.Get(options::kNodeIntegrationInSubFrames,
-                      &node_integration_in_sub_frames_);
-  web_preferences.Get(options::kNodeIntegrationInWorker,
-                      &node_integration_in_worker_);
-  web_preferences.Get(options::kDisableHtmlFullscreenWindowResize,
-                      &disable_html_fullscreen_window_resize_);
-  web_preferences.Get(options::kWebviewTag, &webview_tag_);
-  bool sandbox;
-  if (web_preferences.Get(options::kSandbox, &sandbox))
-    sandbox_ = sandbox;
-  web_preferences.Get(options::kContextIsolation, &context_isolation_);
-  web_preferences.Get(options::kJavaScript, &javascript_);
-  web_preferences.Get(options::kImages, &images_);
-  web_preferences.Get(options::kTextAreasAreResizable,
-                      &text_areas_are_resizable_);
-  web_preferences.Get(options::kWebGL, &webgl_);
-  web_preferences.Get(options::kEnablePreferredSizeMode,
-                      &enable_preferred_size_mode_);
-  web_preferences.Get(options::kWebSecurity, &web_security_);
+  // Preferences that map straight onto a member. The rest depend on each
+  // other or need extra processing, and are read below.
+  using Prefs = WebContentsPreferences;
+  static constexpr auto kFields = std::tuple(
+      gin::StructField{options::kPlugins, &Prefs::plugins_},
+      gin::StructField{options::kExperimentalFeatures,
+                       &Prefs::experimental_features_},
+      gin::StructField{options::kNodeIntegration, &Prefs::node_integration_},
+      gin::StructField{options::kNodeIntegrationInSubFrames,
+                       &Prefs::node_integration_in_sub_frames_},
+      gin::StructField{options::kNodeIntegrationInWorker,
+                       &Prefs::node_integration_in_worker_},
+      gin::StructField{options::kDisableHtmlFullscreenWindowResize,
+                       &Prefs::disable_html_fullscreen_window_resize_},
+      gin::StructField{options::kWebviewTag, &Prefs::webview_tag_},
+      gin::StructField{options::kSandbox, &Prefs::sandbox_},
+      gin::StructField{options::kContextIsolation, &Prefs::context_isolation_},
+      gin::StructField{options::kJavaScript, &Prefs::javascript_},
+      gin::StructField{options::kImages, &Prefs::images_},
+      gin::StructField{options::kTextAreasAreResizable,
+                       &Prefs::text_areas_are_resizable_},
+      gin::StructField{options::kWebGL, &Prefs::webgl_},
+      gin::StructField{options::kEnablePreferredSizeMode,
+                       &Prefs::enable_preferred_size_mode_},
+      gin::StructField{options::kWebSecurity, &Prefs::web_security_},
+      gin::StructField{options::kOffscreen, &Prefs::offscreen_},
+      gin::StructField{options::kNavigateOnDragDrop,
+                       &Prefs::navigate_on_drag_drop_},
+      gin::StructField{"autoplayPolicy", &Prefs::autoplay_policy_},
+      gin::StructField{"defaultFontFamily", &Prefs::default_font_family_},
+      gin::StructField{"defaultFontSize", &Prefs::default_font_size_},
+      gin::StructField{"defaultMonospaceFontSize",
+                       &Prefs::default_monospace_font_size_},
+      gin::StructField{"minimumFontSize", &Prefs::minimum_font_size_},
+      gin::StructField{"defaultEncoding", &Prefs::default_encoding_},
+      gin::StructField{options::kCustomArgs, &Prefs::custom_args_},
+      gin::StructField{"commandLineSwitches", &Prefs::custom_switches_},
+      gin::StructField{"disablePopups", &Prefs::disable_popups_},
+      gin::StructField{"disableDialogs", &Prefs::disable_dialogs_},
+      gin::StructField{"safeDialogs", &Prefs::safe_dialogs_},
+      gin::StructField{"safeDialogsMessage", &Prefs::safe_dialogs_message_},
+      gin::StructField{"ignoreMenuShortcuts", &Prefs::ignore_menu_shortcuts_},
+      gin::StructField{options::kEnableBlinkFeatures,
+                       &Prefs::enable_blink_features_},
+      gin::StructField{options::kDisableBlinkFeatures,
+                       &Prefs::disable_blink_features_},
+      gin::StructField{"v8CacheOptions", &Prefs::v8_cache_options_});
+  gin::ReadStructFields(web_preferences.isolate(), web_preferences.GetHandle(),
+                        this, kFields);
+
   if (!web_preferences.Get(options::kAllowRunningInsecureContent,
                            &allow_running_insecure_content_) &&
       !web_security_)
     allow_running_insecure_content_ = true;
-  web_preferences.Get(options::kOffscreen, &offscreen_);
-  web_preferences.Get(options::kNavigateOnDragDrop, &navigate_on_drag_drop_);
-  web_preferences.Get("autoplayPolicy", &autoplay_policy_);
-  web_preferences.Get("defaultFontFamily", &default_font_family_);
-  int size;
-  if (web_preferences.Get("defaultFontSize", &size))
-    default_font_size_ = size;
-  if (web_preferences.Get("defaultMonospaceFontSize", &size))
-    default_monospace_font_size_ = size;
-  if (web_preferences.Get("minimumFontSize", &size))
-    minimum_font_size_ = size;
-  std::string encoding;
-  if (web_preferences.Get("defaultEncoding", &encoding))
-    default_encoding_ = encoding;
-  web_preferences.Get(options::kCustomArgs, &custom_args_);
-  web_preferences.Get("commandLineSwitches", &custom_switches_);
-  web_preferences.Get("disablePopups", &disable_popups_);
-  web_preferences.Get("disableDialogs", &disable_dialogs_);
-  web_preferences.Get("safeDialogs", &safe_dialogs_);
   // preferences don't save a transparency option,
   // apply any existing transparency setting to background_color_
   bool transparent;
@@ -215,18 +226,6 @@ void WebContentsPreferences::SetFromDictionary(
   std::string background_color;
   if (web_preferences.GetHidden(options::kBackgroundColor, &background_color))
     background_color_ = ParseCSSColor(background_color);
-  std::string safe_dialogs_message;
-  if (web_preferences.Get("safeDialogsMessage", &safe_dialogs_message))
-    safe_dialogs_message_ = safe_dialogs_message;
-  web_preferences.Get("ignoreMenuShortcuts", &ignore_menu_shortcuts_);
-  std::string enable_blink_features;
-  if (web_preferences.Get(options::kEnableBlinkFeatures,
-                          &enable_blink_features))
-    enable_blink_features_ = enable_blink_features;
-  std::string disable_blink_features;
-  if (web_preferences.Get(options::kDisableBlinkFeatures,
-                          &disable_blink_features))
-    disable_blink_features_ = disable_blink_features;
 
   base::FilePath::StringType preload_path;
   if (web_preferences.Get(options::kPreloadScript, &preload_path)) {
@@ -243,8 +242,6 @@ void WebContentsPreferences::SetFromDictionary(
     is_webview_ = type == "webview";
   }
 
-  web_preferences.Get("v8CacheOptions", &v8_cache_options_);
-
 #if BUILDFLAG(IS_MAC)
   web_preferences.Get(options::kScrollBounce, &scroll_bounce_);
 #endif
@@ -293,6 +290,19 @@ content::WebContents* WebContentsPreferences::GetWebContentsFromProcessID(
   return nullptr;
 }
 
+// static
+size_t WebContentsPreferences::GetWebContentsCountForProcessID(
+    int process_id) {
+  size_t count = 0;
+  for (WebContentsPreferences* preferences : Instances()) {
+    content::WebContents* web_contents = preferences->web_contents_;
+    if (web_contents->GetPrimaryMainFrame()->GetProcess()->GetID() ==
+        process_id)
+      ++count;
+  }
+  return count;
+}
+
 // static
 WebContentsPreferences* WebContentsPreferences::From(
     content::WebContents* web_contents) {
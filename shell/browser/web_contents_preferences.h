@@ -83,10 +83,14 @@ class WebContentsPreferences
  private:
   friend class content::WebContentsUserData<WebContentsPreferences>;
   friend class ElectronBrowserClient;
+  friend class RendererProcessSharing;
 
   // Get WebContents according to process ID.
   static content::WebContents* GetWebContentsFromProcessID(int process_id);
 
+  // Get the number of WebContents whose main frame is in the process.
+  static size_t GetWebContentsCountForProcessID(int process_id);
+
   void Clear();
   void SaveLastPreferences();
 
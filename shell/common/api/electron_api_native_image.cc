@@ -10,10 +10,12 @@
 #include <vector>
 
 #include "base/files/file_util.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/pattern.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "gin/arguments.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
@@ -21,6 +23,7 @@
 #include "net/base/data_url.h"
 #include "shell/browser/browser.h"
 #include "shell/common/asar/asar_util.h"
+#include "shell/common/decoded_image_cache.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gfx_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
@@ -29,10 +32,12 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/process_util.h"
 #include "shell/common/skia_util.h"
 #include "shell/common/thread_restrictions.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
@@ -92,6 +97,103 @@ base::FilePath NormalizePath(const base::FilePath& path) {
   }
 }
 
+// gfx::ImageSkia may only be used on the sequence that created it, so the
+// asynchronous variants below pass bitmaps to and from the thread pool and
+// only build images on the calling thread.
+using ImageReps = std::vector<gfx::ImageSkiaRep>;
+
+constexpr base::TaskTraits kImageTaskTraits = {
+    base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+    base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN};
+
+gfx::ImageSkia ImageSkiaFromReps(const ImageReps& reps) {
+  gfx::ImageSkia image_skia;
+  for (const gfx::ImageSkiaRep& rep : reps)
+    image_skia.AddRepresentation(rep);
+  return image_skia;
+}
+
+ImageReps DecodeFromPath(const base::FilePath& path) {
+  return DecodedImageCache::GetInstance()->GetOrDecode(NormalizePath(path));
+}
+
+ImageReps DecodeFromBuffer(const std::vector<unsigned char>& buffer,
+                           int width,
+                           int height,
+                           double scale_factor) {
+  gfx::ImageSkia image_skia;
+  electron::util::AddImageSkiaRepFromBuffer(&image_skia, buffer.data(),
+                                            buffer.size(), width, height,
+                                            scale_factor);
+  return image_skia.image_reps();
+}
+
+ImageReps DecodeFromDataURL(const GURL& url) {
+  gfx::ImageSkia image_skia;
+  std::string mime_type, charset, data;
+  if (net::DataURL::Parse(url, &mime_type, &charset, &data)) {
+    auto* data_ptr = reinterpret_cast<const unsigned char*>(data.c_str());
+    if (mime_type == "image/png") {
+      electron::util::AddImageSkiaRepFromPNG(&image_skia, data_ptr,
+                                             data.size(), 1.0);
+    } else if (mime_type == "image/jpeg") {
+      electron::util::AddImageSkiaRepFromJPEG(&image_skia, data_ptr,
+                                              data.size(), 1.0);
+    }
+  }
+  return image_skia.image_reps();
+}
+
+std::vector<unsigned char> EncodePNG(const SkBitmap& bitmap) {
+  std::vector<unsigned char> encoded;
+  gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
+  return encoded;
+}
+
+std::vector<unsigned char> EncodeJPEG(const SkBitmap& bitmap, int quality) {
+  std::vector<unsigned char> encoded;
+  if (!bitmap.readyToDraw() ||
+      !gfx::JPEGCodec::Encode(bitmap, quality, &encoded)) {
+    encoded.clear();
+  }
+  return encoded;
+}
+
+ImageReps ResizeReps(const ImageReps& reps,
+                     const gfx::Size& size,
+                     skia::ImageOperations::ResizeMethod method) {
+  ImageReps resized;
+  for (const gfx::ImageSkiaRep& rep : reps) {
+    const gfx::Size pixel_size = gfx::ScaleToCeiledSize(size, rep.scale());
+    resized.emplace_back(
+        skia::ImageOperations::Resize(rep.GetBitmap(), method,
+                                      pixel_size.width(), pixel_size.height()),
+        rep.scale());
+  }
+  return resized;
+}
+
+skia::ImageOperations::ResizeMethod GetResizeMethod(
+    const base::Value::Dict& options) {
+  const std::string* quality = options.FindString("quality");
+  if (quality && *quality == "good")
+    return skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  if (quality && *quality == "better")
+    return skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+}
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::vector<unsigned char> data) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(node::Buffer::Copy(isolate,
+                                     reinterpret_cast<const char*>(data.data()),
+                                     data.size())
+                      .ToLocalChecked());
+}
+
 #if BUILDFLAG(IS_MAC)
 bool IsTemplateFilename(const base::FilePath& path) {
   return (base::MatchPattern(path.value(), "*Template.*") ||
@@ -276,6 +378,51 @@ v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
       .ToLocalChecked();
 }
 
+v8::Local<v8::Promise> NativeImage::ToPNGAsync(gin::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Images created from PNG data keep the encoded bytes around.
+  if (scale_factor == 1.0f &&
+      image_.HasRepresentation(gfx::Image::kImageRepPNG)) {
+    scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    promise.Resolve(
+        node::Buffer::Copy(args->isolate(),
+                           reinterpret_cast<const char*>(png->front()),
+                           png->size())
+            .ToLocalChecked());
+    return handle;
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits, base::BindOnce(&EncodePNG, bitmap),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                                                int quality) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Like toJPEG(), only a 1x representation is encoded.
+  const gfx::ImageSkiaRep rep = image_.AsImageSkia().GetRepresentation(1.0f);
+  if (rep.scale() != 1.0f) {
+    promise.Resolve(node::Buffer::New(isolate, 0).ToLocalChecked());
+    return handle;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&EncodeJPEG, rep.GetBitmap(), quality),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
 std::string NativeImage::ToDataURL(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
@@ -342,10 +489,9 @@ float NativeImage::GetAspectRatio(const std::optional<float> scale_factor) {
     return static_cast<float>(size.width()) / static_cast<float>(size.height());
 }
 
-gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
-                                             base::Value::Dict options) {
-  float scale_factor = GetScaleFactorFromOptions(args);
-
+std::optional<gfx::Size> NativeImage::GetResizedSize(
+    float scale_factor,
+    const base::Value::Dict& options) {
   gfx::Size size = GetSize(scale_factor);
   std::optional<int> new_width = options.FindInt("width");
   std::optional<int> new_height = options.FindInt("height");
@@ -354,7 +500,7 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
   size.SetSize(width, height);
 
   if (width <= 0 && height <= 0) {
-    return CreateEmpty(args->isolate());
+    return std::nullopt;
   } else if (new_width && !new_height) {
     // Scale height to preserve original aspect ratio
     size.set_height(width);
@@ -365,21 +511,49 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
     size.set_width(height);
     size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
   }
+  return size;
+}
 
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string* quality = options.FindString("quality");
-  if (quality && *quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality && *quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
+                                             base::Value::Dict options) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  std::optional<gfx::Size> size = GetResizedSize(scale_factor, options);
+  if (!size)
+    return CreateEmpty(args->isolate());
 
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
-      image_.AsImageSkia(), method, size);
+      image_.AsImageSkia(), GetResizeMethod(options), *size);
   return gin::CreateHandle(
       args->isolate(), new NativeImage(args->isolate(), gfx::Image(resized)));
 }
 
+v8::Local<v8::Promise> NativeImage::ResizeAsync(gin::Arguments* args,
+                                                base::Value::Dict options) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::optional<gfx::Size> size = GetResizedSize(scale_factor, options);
+  if (!size) {
+    promise.Resolve(CreateEmpty(args->isolate()));
+    return handle;
+  }
+
+  // Representations produced lazily by an image source, e.g. the result of
+  // a synchronous resize(), have to be materialized here.
+  gfx::ImageSkia image_skia = image_.AsImageSkia();
+  image_skia.EnsureRepsForSupportedScales();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&ResizeReps, image_skia.image_reps(), *size,
+                     GetResizeMethod(options)),
+      base::BindOnce(&NativeImage::ResolveDecoded, std::move(promise),
+                     base::FilePath()));
+  return handle;
+}
+
 gin::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
                                            const gfx::Rect& rect) {
   gfx::ImageSkia cropped =
@@ -476,9 +650,8 @@ gin::Handle<NativeImage> NativeImage::CreateFromPath(
     return gin::CreateHandle(isolate, new NativeImage(isolate, image_path));
   }
 #endif
-  gfx::ImageSkia image_skia;
-  electron::util::PopulateImageSkiaRepsFromPath(&image_skia, image_path);
-  gfx::Image image(image_skia);
+  gfx::Image image(ImageSkiaFromReps(
+      DecodedImageCache::GetInstance()->GetOrDecode(image_path)));
   gin::Handle<NativeImage> handle = Create(isolate, image);
 #if BUILDFLAG(IS_MAC)
   if (IsTemplateFilename(image_path))
@@ -577,6 +750,96 @@ gin::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
   return CreateEmpty(isolate);
 }
 
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromPathAsync(
+    v8::Isolate* isolate,
+    const base::FilePath& path) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+#if BUILDFLAG(IS_WIN)
+  // Icons are loaded through the shell one size at a time, which needs the
+  // path to stay attached to the image.
+  if (path.MatchesExtension(FILE_PATH_LITERAL(".ico"))) {
+    promise.Resolve(CreateFromPath(isolate, path));
+    return handle;
+  }
+#endif
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits, base::BindOnce(&DecodeFromPath, path),
+      base::BindOnce(&NativeImage::ResolveDecoded, std::move(promise), path));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromBufferAsync(
+    v8::Local<v8::Value> buffer,
+    gin::Arguments* args) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!node::Buffer::HasInstance(buffer)) {
+    promise.RejectWithErrorMessage("buffer must be a node Buffer");
+    return handle;
+  }
+
+  int width = 0;
+  int height = 0;
+  double scale_factor = 1.;
+
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("width", &width);
+    options.Get("height", &height);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  // The caller is free to reuse the buffer once this returns.
+  const auto* data =
+      reinterpret_cast<const unsigned char*>(node::Buffer::Data(buffer));
+  std::vector<unsigned char> copy(data, data + node::Buffer::Length(buffer));
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&DecodeFromBuffer, std::move(copy), width, height,
+                     scale_factor),
+      base::BindOnce(&NativeImage::ResolveDecoded, std::move(promise),
+                     base::FilePath()));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromDataURLAsync(
+    v8::Isolate* isolate,
+    const GURL& url) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits, base::BindOnce(&DecodeFromDataURL, url),
+      base::BindOnce(&NativeImage::ResolveDecoded, std::move(promise),
+                     base::FilePath()));
+  return handle;
+}
+
+// static
+void NativeImage::ResolveDecoded(
+    gin_helper::Promise<gin::Handle<NativeImage>> promise,
+    const base::FilePath& path,
+    std::vector<gfx::ImageSkiaRep> reps) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  gin::Handle<NativeImage> handle =
+      Create(isolate, gfx::Image(ImageSkiaFromReps(reps)));
+#if BUILDFLAG(IS_MAC)
+  if (IsTemplateFilename(path))
+    handle->SetTemplateImage(true);
+#endif
+  promise.Resolve(handle);
+}
+
 #if !BUILDFLAG(IS_MAC)
 gin::Handle<NativeImage> NativeImage::CreateFromNamedImage(gin::Arguments* args,
                                                            std::string name) {
@@ -600,6 +863,8 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
                                     constructor->InstanceTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getScaleFactors", &NativeImage::GetScaleFactors)
@@ -612,6 +877,7 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
@@ -646,6 +912,12 @@ void Initialize(v8::Local<v8::Object> exports,
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
+  native_image.SetMethod("createFromPathAsync",
+                         &NativeImage::CreateFromPathAsync);
+  native_image.SetMethod("createFromBufferAsync",
+                         &NativeImage::CreateFromBufferAsync);
+  native_image.SetMethod("createFromDataURLAsync",
+                         &NativeImage::CreateFromDataURLAsync);
 #if !BUILDFLAG(IS_LINUX)
   native_image.SetMethod("createThumbnailFromPath",
                          &NativeImage::CreateThumbnailFromPath);
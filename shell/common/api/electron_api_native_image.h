@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_COMMON_API_ELECTRON_API_NATIVE_IMAGE_H_
 #define ELECTRON_SHELL_COMMON_API_ELECTRON_API_NATIVE_IMAGE_H_
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -41,6 +42,9 @@ class Handle;
 namespace gin_helper {
 class Dictionary;
 class ErrorThrower;
+
+template <typename T>
+class Promise;
 }  // namespace gin_helper
 
 namespace electron::api {
@@ -80,6 +84,14 @@ class NativeImage final : public gin::Wrappable<NativeImage> {
                                                     const GURL& url);
   static gin::Handle<NativeImage> CreateFromNamedImage(gin::Arguments* args,
                                                        std::string name);
+  static v8::Local<v8::Promise> CreateFromPathAsync(
+      v8::Isolate* isolate,
+      const base::FilePath& path);
+  static v8::Local<v8::Promise> CreateFromBufferAsync(
+      v8::Local<v8::Value> buffer,
+      gin::Arguments* args);
+  static v8::Local<v8::Promise> CreateFromDataURLAsync(v8::Isolate* isolate,
+                                                       const GURL& url);
 #if !BUILDFLAG(IS_LINUX)
   static v8::Local<v8::Promise> CreateThumbnailFromPath(
       v8::Isolate* isolate,
@@ -117,12 +129,28 @@ class NativeImage final : public gin::Wrappable<NativeImage> {
   gin::Handle<NativeImage> Resize(gin::Arguments* args,
                                   base::Value::Dict options);
   gin::Handle<NativeImage> Crop(v8::Isolate* isolate, const gfx::Rect& rect);
+  v8::Local<v8::Promise> ToPNGAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ToJPEGAsync(v8::Isolate* isolate, int quality);
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     base::Value::Dict options);
   std::string ToDataURL(gin::Arguments* args);
   bool IsEmpty();
   gfx::Size GetSize(const std::optional<float> scale_factor);
   float GetAspectRatio(const std::optional<float> scale_factor);
   void AddRepresentation(const gin_helper::Dictionary& options);
 
+  // The size resize() produces for |options|, or nullopt if the result is
+  // an empty image.
+  std::optional<gfx::Size> GetResizedSize(float scale_factor,
+                                          const base::Value::Dict& options);
+
+  // Wraps representations decoded on the thread pool in a new NativeImage.
+  // |path| is the file they were read from, if any.
+  static void ResolveDecoded(
+      gin_helper::Promise<gin::Handle<NativeImage>> promise,
+      const base::FilePath& path,
+      std::vector<gfx::ImageSkiaRep> reps);
+
   void UpdateExternalAllocatedMemoryUsage();
 
   // Mark the image as template image.
@@ -2,10 +2,22 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
 #include "base/dcheck_is_on.h"
 #include "base/logging.h"
+#include "base/time/time.h"
+#include "base/values.h"
+#include "content/public/renderer/v8_value_converter.h"
+#include "gin/data_object_builder.h"
+#include "shell/common/gin_converters/struct_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/resource_cache.h"
 #include "v8/include/v8.h"
 
 #if DCHECK_IS_ON()
@@ -34,12 +46,138 @@ void Log(int severity, std::string text) {
   }
 }
 
+// Converts |value| to a base::Value and back, as every API taking or
+// returning one does.
+v8::Local<v8::Value> RoundTripValue(v8::Isolate* isolate,
+                                    v8::Local<v8::Value> value) {
+  base::Value out;
+  if (!gin::ConvertFromV8(isolate, value, &out))
+    return v8::Undefined(isolate);
+  return gin::ConvertToV8(isolate, out);
+}
+
+// Converts |value| to a base::Value |iterations| times with the gin converter
+// and with content::V8ValueConverter, and tells how long each took in
+// milliseconds.
+v8::Local<v8::Value> BenchmarkValueConverter(v8::Isolate* isolate,
+                                             v8::Local<v8::Value> value,
+                                             int iterations) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i) {
+    base::Value out;
+    gin::ConvertFromV8(isolate, value, &out);
+  }
+  const base::TimeDelta converter = base::TimeTicks::Now() - start;
+
+  std::unique_ptr<content::V8ValueConverter> v8_value_converter =
+      content::V8ValueConverter::Create();
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i)
+    v8_value_converter->FromV8Value(value, context);
+  const base::TimeDelta legacy = base::TimeTicks::Now() - start;
+
+  return gin::DataObjectBuilder(isolate)
+      .Set("converter", converter.InMillisecondsF())
+      .Set("v8ValueConverter", legacy.InMillisecondsF())
+      .Build();
+}
+
+// An option struct shaped like those of printToPDF and webPreferences.
+struct BenchmarkOptions {
+  bool landscape = false;
+  bool print_background = false;
+  std::optional<bool> sandbox;
+  std::optional<bool> context_isolation;
+  double scale = 1.0;
+  double margin_top = 0;
+  double margin_bottom = 0;
+  std::optional<int> default_font_size;
+  std::string header_template;
+  std::string footer_template;
+  std::optional<std::string> default_encoding;
+  std::optional<std::string> autoplay_policy;
+};
+
+constexpr auto kBenchmarkOptionsFields = std::tuple(
+    gin::StructField{"landscape", &BenchmarkOptions::landscape},
+    gin::StructField{"printBackground", &BenchmarkOptions::print_background},
+    gin::StructField{"sandbox", &BenchmarkOptions::sandbox},
+    gin::StructField{"contextIsolation", &BenchmarkOptions::context_isolation},
+    gin::StructField{"scale", &BenchmarkOptions::scale},
+    gin::StructField{"marginTop", &BenchmarkOptions::margin_top},
+    gin::StructField{"marginBottom", &BenchmarkOptions::margin_bottom},
+    gin::StructField{"defaultFontSize", &BenchmarkOptions::default_font_size},
+    gin::StructField{"headerTemplate", &BenchmarkOptions::header_template},
+    gin::StructField{"footerTemplate", &BenchmarkOptions::footer_template},
+    gin::StructField{"defaultEncoding", &BenchmarkOptions::default_encoding},
+    gin::StructField{"autoplayPolicy", &BenchmarkOptions::autoplay_policy});
+
+// Reads |options| into a BenchmarkOptions |iterations| times through its
+// field table and through gin_helper::Dictionary::Get, and tells how long
+// each took in milliseconds.
+v8::Local<v8::Value> BenchmarkStructConverter(v8::Isolate* isolate,
+                                              v8::Local<v8::Object> options,
+                                              int iterations) {
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i) {
+    BenchmarkOptions out;
+    gin::ReadStructFields(isolate, options, &out, kBenchmarkOptionsFields);
+  }
+  const base::TimeDelta converter = base::TimeTicks::Now() - start;
+
+  gin_helper::Dictionary dict(isolate, options);
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i) {
+    BenchmarkOptions out;
+    dict.Get("landscape", &out.landscape);
+    dict.Get("printBackground", &out.print_background);
+    if (bool sandbox; dict.Get("sandbox", &sandbox))
+      out.sandbox = sandbox;
+    if (bool isolation; dict.Get("contextIsolation", &isolation))
+      out.context_isolation = isolation;
+    dict.Get("scale", &out.scale);
+    dict.Get("marginTop", &out.margin_top);
+    dict.Get("marginBottom", &out.margin_bottom);
+    if (int size; dict.Get("defaultFontSize", &size))
+      out.default_font_size = size;
+    dict.Get("headerTemplate", &out.header_template);
+    dict.Get("footerTemplate", &out.footer_template);
+    if (std::string encoding; dict.Get("defaultEncoding", &encoding))
+      out.default_encoding = std::move(encoding);
+    if (std::string policy; dict.Get("autoplayPolicy", &policy))
+      out.autoplay_policy = std::move(policy);
+  }
+  const base::TimeDelta dictionary = base::TimeTicks::Now() - start;
+
+  return gin::DataObjectBuilder(isolate)
+      .Set("structFields", converter.InMillisecondsF())
+      .Set("dictionary", dictionary.InMillisecondsF())
+      .Build();
+}
+
+// Tells how many resources this process can load from the resource cache, and
+// how many times it has.
+v8::Local<v8::Value> GetResourceCacheInfo(v8::Isolate* isolate) {
+  const electron::ResourceCache* cache = electron::ResourceCache::Get();
+  return gin::DataObjectBuilder(isolate)
+      .Set("resourceCount",
+           static_cast<double>(cache->GetResourceCountForTesting()))
+      .Set("loadCount", static_cast<double>(cache->GetLoadCountForTesting()))
+      .Build();
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
                 void* priv) {
   gin_helper::Dictionary dict(context->GetIsolate(), exports);
   dict.SetMethod("log", &Log);
+  dict.SetMethod("roundTripValue", &RoundTripValue);
+  dict.SetMethod("benchmarkValueConverter", &BenchmarkValueConverter);
+  dict.SetMethod("benchmarkStructConverter", &BenchmarkStructConverter);
+  dict.SetMethod("getResourceCacheInfo", &GetResourceCacheInfo);
 }
 
 }  // namespace
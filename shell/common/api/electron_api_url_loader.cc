@@ -6,8 +6,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -42,6 +44,7 @@
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
+#include "shell/common/gin_converters/struct_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/gin_helper/promise.h"
@@ -321,6 +324,44 @@ const net::NetworkTrafficAnnotationTag kTrafficAnnotation =
           setting: "This feature cannot be disabled."
         })");
 
+// The options of a request that are read as they are. The session is looked
+// up separately, only in the browser process.
+struct RequestOptions {
+  std::optional<std::string> method;
+  GURL url;
+  GURL referrer;
+  std::optional<net::ReferrerPolicy> referrer_policy;
+  std::string origin;
+  std::optional<bool> has_user_activation;
+  std::optional<std::string> mode;
+  std::optional<std::string> destination;
+  std::optional<network::mojom::CredentialsMode> credentials;
+  std::optional<std::vector<std::pair<std::string, std::string>>>
+      extra_headers;
+  blink::mojom::FetchCacheMode cache = blink::mojom::FetchCacheMode::kDefault;
+  bool use_session_cookies = false;
+  bool bypass_custom_protocol_handlers = false;
+  v8::Local<v8::Value> body;
+};
+
+constexpr auto kRequestOptionsFields = std::tuple(
+    gin::StructField{"method", &RequestOptions::method},
+    gin::StructField{"url", &RequestOptions::url},
+    gin::StructField{"referrer", &RequestOptions::referrer},
+    gin::StructField{"referrerPolicy", &RequestOptions::referrer_policy},
+    gin::StructField{"origin", &RequestOptions::origin},
+    gin::StructField{"hasUserActivation",
+                     &RequestOptions::has_user_activation},
+    gin::StructField{"mode", &RequestOptions::mode},
+    gin::StructField{"destination", &RequestOptions::destination},
+    gin::StructField{"credentials", &RequestOptions::credentials},
+    gin::StructField{"extraHeaders", &RequestOptions::extra_headers},
+    gin::StructField{"cache", &RequestOptions::cache},
+    gin::StructField{"useSessionCookies", &RequestOptions::use_session_cookies},
+    gin::StructField{"bypassCustomProtocolHandlers",
+                     &RequestOptions::bypass_custom_protocol_handlers},
+    gin::StructField{"body", &RequestOptions::body});
+
 }  // namespace
 
 gin::WrapperInfo SimpleURLLoaderWrapper::kWrapperInfo = {
@@ -531,30 +572,32 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
     args->ThrowTypeError("Expected a dictionary");
     return gin::Handle<SimpleURLLoaderWrapper>();
   }
+  RequestOptions options;
+  gin::ReadStructFields(args->isolate(), opts.GetHandle(), &options,
+                        kRequestOptionsFields);
+
   auto request = std::make_unique<network::ResourceRequest>();
-  opts.Get("method", &request->method);
-  opts.Get("url", &request->url);
+  if (options.method)
+    request->method = std::move(*options.method);
+  request->url = std::move(options.url);
   if (!request->url.is_valid()) {
     args->ThrowTypeError("Invalid URL");
     return gin::Handle<SimpleURLLoaderWrapper>();
   }
   request->site_for_cookies = net::SiteForCookies::FromUrl(request->url);
-  opts.Get("referrer", &request->referrer);
-  request->referrer_policy =
-      blink::ReferrerUtils::GetDefaultNetReferrerPolicy();
-  opts.Get("referrerPolicy", &request->referrer_policy);
-  std::string origin;
-  opts.Get("origin", &origin);
-  if (!origin.empty()) {
-    request->request_initiator = url::Origin::Create(GURL(origin));
+  request->referrer = std::move(options.referrer);
+  request->referrer_policy = options.referrer_policy.value_or(
+      blink::ReferrerUtils::GetDefaultNetReferrerPolicy());
+  if (!options.origin.empty()) {
+    request->request_initiator = url::Origin::Create(GURL(options.origin));
   }
-  bool has_user_activation;
-  if (opts.Get("hasUserActivation", &has_user_activation)) {
+  if (options.has_user_activation) {
     request->trusted_params = network::ResourceRequest::TrustedParams();
-    request->trusted_params->has_user_activation = has_user_activation;
+    request->trusted_params->has_user_activation =
+        *options.has_user_activation;
   }
 
-  if (std::string mode; opts.Get("mode", &mode)) {
+  if (options.mode) {
     using Val = network::mojom::RequestMode;
     static constexpr auto Lookup =
         base::MakeFixedFlatMap<std::string_view, Val>({
@@ -563,11 +606,11 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
             {"no-cors", Val::kNoCors},
             {"same-origin", Val::kSameOrigin},
         });
-    if (auto* iter = Lookup.find(mode); iter != Lookup.end())
+    if (auto* iter = Lookup.find(*options.mode); iter != Lookup.end())
       request->mode = iter->second;
   }
 
-  if (std::string destination; opts.Get("destination", &destination)) {
+  if (options.destination) {
     using Val = network::mojom::RequestDestination;
     static constexpr auto Lookup =
         base::MakeFixedFlatMap<std::string_view, Val>({
@@ -592,15 +635,15 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
             {"worker", Val::kWorker},
             {"xslt", Val::kXslt},
         });
-    if (auto* iter = Lookup.find(destination); iter != Lookup.end())
+    if (auto* iter = Lookup.find(*options.destination); iter != Lookup.end())
       request->destination = iter->second;
   }
 
-  bool credentials_specified =
-      opts.Get("credentials", &request->credentials_mode);
-  std::vector<std::pair<std::string, std::string>> extra_headers;
-  if (opts.Get("extraHeaders", &extra_headers)) {
-    for (const auto& it : extra_headers) {
+  const bool credentials_specified = options.credentials.has_value();
+  if (options.credentials)
+    request->credentials_mode = *options.credentials;
+  if (options.extra_headers) {
+    for (const auto& it : *options.extra_headers) {
       if (!net::HttpUtil::IsValidHeaderName(it.first) ||
           !net::HttpUtil::IsValidHeaderValue(it.second)) {
         args->ThrowTypeError("Invalid header name or value");
@@ -610,10 +653,7 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
     }
   }
 
-  blink::mojom::FetchCacheMode cache_mode =
-      blink::mojom::FetchCacheMode::kDefault;
-  opts.Get("cache", &cache_mode);
-  switch (cache_mode) {
+  switch (options.cache) {
     case blink::mojom::FetchCacheMode::kNoStore:
       request->load_flags |= net::LOAD_DISABLE_CACHE;
       break;
@@ -640,25 +680,20 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
       break;
   }
 
-  bool use_session_cookies = false;
-  opts.Get("useSessionCookies", &use_session_cookies);
-  int options = network::mojom::kURLLoadOptionSniffMimeType;
-  if (!credentials_specified && !use_session_cookies) {
+  int load_options = network::mojom::kURLLoadOptionSniffMimeType;
+  if (!credentials_specified && !options.use_session_cookies) {
     // This is the default case, as well as the case when credentials is not
     // specified and useSessionCookies is false. credentials_mode will be
     // kInclude, but cookies will be blocked.
     request->credentials_mode = network::mojom::CredentialsMode::kInclude;
-    options |= network::mojom::kURLLoadOptionBlockAllCookies;
+    load_options |= network::mojom::kURLLoadOptionBlockAllCookies;
   }
 
-  bool bypass_custom_protocol_handlers = false;
-  opts.Get("bypassCustomProtocolHandlers", &bypass_custom_protocol_handlers);
-  if (bypass_custom_protocol_handlers)
-    options |= kBypassCustomProtocolHandlers;
+  if (options.bypass_custom_protocol_handlers)
+    load_options |= kBypassCustomProtocolHandlers;
 
-  v8::Local<v8::Value> body;
   v8::Local<v8::Value> chunk_pipe_getter;
-  if (opts.Get("body", &body)) {
+  if (v8::Local<v8::Value> body = options.body; !body.IsEmpty()) {
     if (body->IsArrayBufferView()) {
       auto buffer_body = body.As<v8::ArrayBufferView>();
       auto backing_store = buffer_body->Buffer()->GetBackingStore();
@@ -697,7 +732,8 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
 
   auto ret = gin::CreateHandle(
       args->isolate(),
-      new SimpleURLLoaderWrapper(browser_context, std::move(request), options));
+      new SimpleURLLoaderWrapper(browser_context, std::move(request),
+                                 load_options));
   ret->Pin();
   if (!chunk_pipe_getter.IsEmpty()) {
     ret->PinBodyGetter(chunk_pipe_getter);
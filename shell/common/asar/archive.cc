@@ -20,6 +20,7 @@
 #include "electron/fuses.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/asar/scoped_temporary_file.h"
+#include "shell/common/startup_profile.h"
 #include "shell/common/thread_restrictions.h"
 
 #if BUILDFLAG(IS_WIN)
@@ -193,6 +194,8 @@ bool Archive::Init() {
   CHECK(!initialized_);
   initialized_ = true;
 
+  electron::ScopedStartupPhase startup_phase("asar::Archive::Init");
+
   if (!file_.IsValid()) {
     if (file_.error_details() != base::File::FILE_ERROR_NOT_FOUND) {
       LOG(WARNING) << "Opening " << path_.value() << ": "
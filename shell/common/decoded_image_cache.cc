@@ -0,0 +1,139 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/decoded_image_cache.h"
+
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/task/sequenced_task_runner.h"
+#include "shell/common/asar/asar_util.h"
+#include "shell/common/skia_util.h"
+#include "shell/common/thread_restrictions.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/image/image_skia.h"
+
+namespace electron {
+
+namespace {
+
+// Enough for a few hundred icons at several scales.
+constexpr size_t kMaxCacheSize = 32 * 1024 * 1024;
+
+// Larger images are unlikely to be icons and would evict everything else.
+constexpr size_t kMaxEntrySize = kMaxCacheSize / 4;
+
+// Files inside an asar archive share the archive's modification time.
+bool GetLastModified(const base::FilePath& path, base::Time* last_modified) {
+  base::FilePath asar_path, relative_path;
+  const base::FilePath& file_path =
+      asar::GetAsarArchivePath(path, &asar_path, &relative_path) ? asar_path
+                                                                 : path;
+  ScopedAllowBlockingForElectron allow_blocking;
+  base::File::Info info;
+  if (!base::GetFileInfo(file_path, &info))
+    return false;
+  *last_modified = info.last_modified;
+  return true;
+}
+
+}  // namespace
+
+DecodedImageCache::Entry::Entry() = default;
+
+DecodedImageCache::Entry::Entry(base::Time last_modified,
+                                std::vector<gfx::ImageSkiaRep> reps,
+                                size_t size)
+    : last_modified{last_modified}, reps{std::move(reps)}, size{size} {}
+
+DecodedImageCache::Entry::Entry(Entry&&) = default;
+DecodedImageCache::Entry& DecodedImageCache::Entry::operator=(Entry&&) =
+    default;
+DecodedImageCache::Entry::~Entry() = default;
+
+// static
+DecodedImageCache* DecodedImageCache::GetInstance() {
+  static base::NoDestructor<DecodedImageCache> instance;
+  return instance.get();
+}
+
+DecodedImageCache::DecodedImageCache() = default;
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+std::vector<gfx::ImageSkiaRep> DecodedImageCache::GetOrDecode(
+    const base::FilePath& path) {
+  base::Time last_modified;
+  const bool cacheable = GetLastModified(path, &last_modified);
+
+  if (cacheable) {
+    base::AutoLock auto_lock(lock_);
+    MaybeListenForMemoryPressure();
+    auto iter = entries_.Get(path);
+    if (iter != entries_.end()) {
+      if (iter->second.last_modified == last_modified)
+        return iter->second.reps;
+      size_ -= iter->second.size;
+      entries_.Erase(iter);
+    }
+  }
+
+  // Decode without holding the lock, so that other threads are not blocked
+  // on it. Concurrent misses for the same path may decode it twice.
+  gfx::ImageSkia image_skia;
+  util::PopulateImageSkiaRepsFromPath(&image_skia, path);
+  std::vector<gfx::ImageSkiaRep> reps = image_skia.image_reps();
+
+  size_t size = 0;
+  for (const gfx::ImageSkiaRep& rep : reps)
+    size += rep.GetBitmap().computeByteSize();
+  if (!cacheable || reps.empty() || size > kMaxEntrySize)
+    return reps;
+
+  base::AutoLock auto_lock(lock_);
+  auto iter = entries_.Peek(path);
+  if (iter != entries_.end()) {
+    size_ -= iter->second.size;
+    entries_.Erase(iter);
+  }
+  entries_.Put(path, Entry(last_modified, reps, size));
+  size_ += size;
+  EvictUntil(kMaxCacheSize);
+  return reps;
+}
+
+void DecodedImageCache::MaybeListenForMemoryPressure() {
+  if (memory_pressure_listener_ ||
+      !base::SequencedTaskRunner::HasCurrentDefault())
+    return;
+  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      FROM_HERE, base::BindRepeating(&DecodedImageCache::OnMemoryPressure,
+                                     base::Unretained(this)));
+}
+
+void DecodedImageCache::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  base::AutoLock auto_lock(lock_);
+  switch (level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      EvictUntil(size_ / 2);
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      EvictUntil(0);
+      break;
+  }
+}
+
+void DecodedImageCache::EvictUntil(size_t size) {
+  while (size_ > size && !entries_.empty()) {
+    auto oldest = entries_.rbegin();
+    size_ -= oldest->second.size;
+    entries_.Erase(oldest);
+  }
+}
+
+}  // namespace electron
@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
+#define ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/time/time.h"
+#include "ui/gfx/image/image_skia_rep.h"
+
+namespace electron {
+
+// Process-wide cache of the images decoded by nativeImage.createFromPath(),
+// keyed by path. Apps tend to load the same tray, menu and toolbar icons
+// over and over, and each load used to read and decode every scale variant
+// of the file again. Entries hold the decoded representations, whose pixels
+// are shared by every image created from them, and are revalidated against
+// the file's modification time on each lookup.
+//
+// The cache is bounded by the size of the decoded pixels, evicts the least
+// recently used entries first, and is trimmed under memory pressure. It can
+// be used from any thread.
+class DecodedImageCache {
+ public:
+  static DecodedImageCache* GetInstance();
+
+  // disable copy
+  DecodedImageCache(const DecodedImageCache&) = delete;
+  DecodedImageCache& operator=(const DecodedImageCache&) = delete;
+
+  // Returns the representations of the image at |path| and its scale
+  // variants, decoding them if they are not cached or the file changed.
+  // Returns an empty list if no image could be read. |path| should already
+  // be normalized.
+  std::vector<gfx::ImageSkiaRep> GetOrDecode(const base::FilePath& path);
+
+ private:
+  friend class base::NoDestructor<DecodedImageCache>;
+
+  struct Entry {
+    Entry();
+    Entry(base::Time last_modified,
+          std::vector<gfx::ImageSkiaRep> reps,
+          size_t size);
+    Entry(Entry&&);
+    Entry& operator=(Entry&&);
+    ~Entry();
+
+    base::Time last_modified;
+    std::vector<gfx::ImageSkiaRep> reps;
+    size_t size = 0;
+  };
+
+  using EntryMap = base::LRUCache<base::FilePath, Entry>;
+
+  DecodedImageCache();
+  ~DecodedImageCache();
+
+  // The listener can only be created on a thread with a task runner, which
+  // the thread pool's parallel tasks do not have.
+  void MaybeListenForMemoryPressure() EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+  void EvictUntil(size_t size) EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  base::Lock lock_;
+  EntryMap entries_ GUARDED_BY(lock_) = EntryMap(EntryMap::NO_AUTO_EVICT);
+  size_t size_ GUARDED_BY(lock_) = 0;
+
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_
+      GUARDED_BY(lock_);
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
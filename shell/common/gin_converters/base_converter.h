@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_COMMON_GIN_CONVERTERS_BASE_CONVERTER_H_
 #define ELECTRON_SHELL_COMMON_GIN_CONVERTERS_BASE_CONVERTER_H_
 
+#include "base/memory/memory_pressure_listener.h"
 #include "base/process/kill.h"
 #include "gin/converter.h"
 #include "shell/common/gin_converters/std_converter.h"
@@ -41,6 +42,23 @@ struct Converter<base::TerminationStatus> {
   }
 };
 
+template <>
+struct Converter<base::MemoryPressureListener::MemoryPressureLevel> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      const base::MemoryPressureListener::MemoryPressureLevel& level) {
+    switch (level) {
+      case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+        return gin::ConvertToV8(isolate, "none");
+      case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+        return gin::ConvertToV8(isolate, "moderate");
+      case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+        return gin::ConvertToV8(isolate, "critical");
+    }
+    NOTREACHED();
+  }
+};
+
 }  // namespace gin
 
 #endif  // ELECTRON_SHELL_COMMON_GIN_CONVERTERS_BASE_CONVERTER_H_
@@ -0,0 +1,115 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/gin_converters/struct_converter.h"
+
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "gin/per_isolate_data.h"
+#include "v8/include/v8-persistent-handle.h"
+
+namespace gin::internal {
+
+namespace {
+
+v8::Local<v8::String> MakeKey(v8::Isolate* isolate, const char* name) {
+  return v8::String::NewFromUtf8(isolate, name,
+                                 v8::NewStringType::kInternalized)
+      .ToLocalChecked();
+}
+
+// The keys of the field tables read in one isolate. It deletes itself once
+// the isolate is disposed.
+class StructFieldKeyCache : public gin::PerIsolateData::DisposeObserver {
+ public:
+  // Returns null for isolates without gin::PerIsolateData, e.g. those of
+  // Node.js Workers, since there is no telling when they go away.
+  static StructFieldKeyCache* From(v8::Isolate* isolate) {
+    gin::PerIsolateData* data = gin::PerIsolateData::From(isolate);
+    if (!data)
+      return nullptr;
+    base::AutoLock auto_lock(GetLock());
+    raw_ptr<StructFieldKeyCache>& cache = GetCaches()[isolate];
+    if (!cache)
+      cache = new StructFieldKeyCache(isolate, data);
+    return cache;
+  }
+
+  // disable copy
+  StructFieldKeyCache(const StructFieldKeyCache&) = delete;
+  StructFieldKeyCache& operator=(const StructFieldKeyCache&) = delete;
+
+  const std::vector<v8::Eternal<v8::String>>& GetKeys(
+      const void* table,
+      base::span<const char* const> names) {
+    std::vector<v8::Eternal<v8::String>>& keys = tables_[table];
+    if (keys.empty()) {
+      keys.reserve(names.size());
+      for (const char* name : names)
+        keys.emplace_back(isolate_, MakeKey(isolate_, name));
+    }
+    DCHECK_EQ(keys.size(), names.size());
+    return keys;
+  }
+
+  // gin::PerIsolateData::DisposeObserver
+  void OnBeforeDispose(v8::Isolate* isolate) override {}
+  void OnDisposed() override {
+    {
+      base::AutoLock auto_lock(GetLock());
+      GetCaches().erase(isolate_);
+    }
+    delete this;
+  }
+
+ private:
+  StructFieldKeyCache(v8::Isolate* isolate, gin::PerIsolateData* data)
+      : isolate_(isolate), data_(data) {
+    data_->AddDisposeObserver(this);
+  }
+
+  ~StructFieldKeyCache() override { data_->RemoveDisposeObserver(this); }
+
+  static base::Lock& GetLock() {
+    static base::NoDestructor<base::Lock> lock;
+    return *lock;
+  }
+
+  static base::flat_map<v8::Isolate*, raw_ptr<StructFieldKeyCache>>&
+  GetCaches() {
+    static base::NoDestructor<
+        base::flat_map<v8::Isolate*, raw_ptr<StructFieldKeyCache>>>
+        caches;
+    return *caches;
+  }
+
+  const raw_ptr<v8::Isolate> isolate_;
+  const raw_ptr<gin::PerIsolateData> data_;
+  base::flat_map<const void*, std::vector<v8::Eternal<v8::String>>> tables_;
+};
+
+}  // namespace
+
+void GetStructFieldKeys(v8::Isolate* isolate,
+                        const void* table,
+                        base::span<const char* const> names,
+                        base::span<v8::Local<v8::String>> keys) {
+  CHECK_EQ(names.size(), keys.size());
+  if (StructFieldKeyCache* cache = StructFieldKeyCache::From(isolate)) {
+    const std::vector<v8::Eternal<v8::String>>& cached =
+        cache->GetKeys(table, names);
+    for (size_t i = 0; i < keys.size(); ++i)
+      keys[i] = cached[i].Get(isolate);
+    return;
+  }
+  for (size_t i = 0; i < keys.size(); ++i)
+    keys[i] = MakeKey(isolate, names[i]);
+}
+
+}  // namespace gin::internal
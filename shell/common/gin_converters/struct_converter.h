@@ -0,0 +1,116 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_GIN_CONVERTERS_STRUCT_CONVERTER_H_
+#define ELECTRON_SHELL_COMMON_GIN_CONVERTERS_STRUCT_CONVERTER_H_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "base/containers/span.h"
+#include "gin/converter.h"
+#include "v8/include/v8-context.h"
+#include "v8/include/v8-object.h"
+#include "v8/include/v8-primitive.h"
+
+namespace gin {
+
+// One entry of a field table: the property |name| is converted into
+// |member|. Tables are tuples of fields, so that they can be constexpr and
+// mix members of any type. Tables must be static, their keys are cached per
+// isolate by address:
+//
+//   static constexpr auto kFields = std::tuple(
+//       gin::StructField{"landscape", &PrintSettings::landscape},
+//       gin::StructField{"scale", &PrintSettings::scale});
+//   gin::ReadStructFields(isolate, object, &settings, kFields);
+template <typename T, typename Member>
+struct StructField {
+  const char* name;
+  Member T::*member;
+};
+
+namespace internal {
+
+template <typename T>
+struct IsOptional : std::false_type {};
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+// Fills |keys| with the internalized strings for |names|, the property names
+// of the field table at |table|. They are created on the first read of the
+// table in |isolate| and kept for as long as it lives.
+void GetStructFieldKeys(v8::Isolate* isolate,
+                        const void* table,
+                        base::span<const char* const> names,
+                        base::span<v8::Local<v8::String>> keys);
+
+template <typename T, typename Member>
+void ReadStructField(v8::Isolate* isolate,
+                     v8::Local<v8::Context> context,
+                     v8::Local<v8::Object> object,
+                     T* out,
+                     const StructField<T, Member>& field,
+                     v8::Local<v8::String> key) {
+  v8::Local<v8::Value> value;
+  if (!object->Get(context, key).ToLocal(&value))
+    return;
+  // Like gin_helper::Dictionary::Get, a property that is present is
+  // converted even when it is undefined, so an undefined boolean reads as
+  // false. Only undefined values take a second lookup to tell them apart
+  // from missing properties.
+  if (value->IsUndefined() && !object->Has(context, key).FromMaybe(false))
+    return;
+
+  // A value that does not convert leaves the member untouched, which for
+  // optional members means unset.
+  if constexpr (IsOptional<Member>::value) {
+    typename Member::value_type converted;
+    if (ConvertFromV8(isolate, value, &converted))
+      (out->*field.member) = std::move(converted);
+  } else {
+    Member converted;
+    if (ConvertFromV8(isolate, value, &converted))
+      (out->*field.member) = std::move(converted);
+  }
+}
+
+template <typename T, typename... Fields, size_t... I>
+void ReadStructFields(v8::Isolate* isolate,
+                      v8::Local<v8::Object> object,
+                      T* out,
+                      const std::tuple<Fields...>& fields,
+                      std::index_sequence<I...>) {
+  static constexpr size_t kCount = sizeof...(Fields);
+  const std::array<const char*, kCount> names = {std::get<I>(fields).name...};
+  std::array<v8::Local<v8::String>, kCount> keys;
+  GetStructFieldKeys(isolate, &fields, names, keys);
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  (ReadStructField(isolate, context, object, out, std::get<I>(fields),
+                   keys[I]),
+   ...);
+}
+
+}  // namespace internal
+
+// Reads every field of |fields| from |object| into |out|, the way
+// gin_helper::Dictionary::Get would read them one by one. Properties that
+// are missing or of the wrong type leave their member as it was.
+template <typename T, typename... Fields>
+void ReadStructFields(v8::Isolate* isolate,
+                      v8::Local<v8::Object> object,
+                      T* out,
+                      const std::tuple<Fields...>& fields) {
+  internal::ReadStructFields(isolate, object, out, fields,
+                             std::index_sequence_for<Fields...>());
+}
+
+}  // namespace gin
+
+#endif  // ELECTRON_SHELL_COMMON_GIN_CONVERTERS_STRUCT_CONVERTER_H_
@@ -4,19 +4,389 @@
 
 #include "shell/common/gin_converters/value_converter.h"
 
-#include <memory>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
+#include <variant>
+#include <vector>
 
-#include "content/public/renderer/v8_value_converter.h"
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
+#include "v8/include/v8-array-buffer.h"
+#include "v8/include/v8-container.h"
+#include "v8/include/v8-exception.h"
+#include "v8/include/v8-primitive.h"
+
+// These converters used to go through content::V8ValueConverter, and follow
+// its default behavior: undefined, functions, symbols and non-finite numbers
+// are left out of objects and become null in arrays, cyclic references and
+// getters that throw become null, properties backed by native accessors are
+// skipped, objects with internal fields convert to empty dictionaries and
+// nesting is limited to 100 levels. Unlike it, they walk the value with an
+// explicit stack, build the result in place rather than through a heap
+// allocated base::Value per node, and intern the keys of the objects they
+// create. script/value-converter-benchmark.js compares the two.
 
 namespace gin {
 
+namespace {
+
+constexpr size_t kMaxDepth = 100;
+
+// Beyond this many distinct keys per conversion, keys are internalized
+// without being remembered.
+constexpr size_t kMaxCachedKeys = 64;
+
+std::string ToUTF8(v8::Isolate* isolate, v8::Local<v8::String> str) {
+  std::string out(str->Utf8Length(isolate), '\0');
+  str->WriteUtf8(isolate, out.data(), out.size(), nullptr,
+                 v8::String::NO_NULL_TERMINATION |
+                     v8::String::REPLACE_INVALID_UTF8);
+  return out;
+}
+
+class V8ToValueConverter {
+ public:
+  explicit V8ToValueConverter(v8::Isolate* isolate)
+      : isolate_{isolate}, try_catch_{isolate} {}
+
+  // disable copy
+  V8ToValueConverter(const V8ToValueConverter&) = delete;
+  V8ToValueConverter& operator=(const V8ToValueConverter&) = delete;
+
+  std::optional<base::Value> Convert(v8::Local<v8::Value> value) {
+    base::Value root;
+    std::string root_key;
+    switch (Visit(value, &root_key, &root)) {
+      case Result::kSkip:
+        return std::nullopt;
+      case Result::kValue:
+        return root;
+      case Result::kContainer:
+        break;
+    }
+
+    while (true) {
+      Frame& frame = stack_.back();
+      if (frame.index == frame.length) {
+        Frame done = std::move(stack_.back());
+        stack_.pop_back();
+        if (stack_.empty())
+          return std::move(done.value);
+        Add(std::move(done.key), std::move(done.value));
+        continue;
+      }
+
+      const uint32_t index = frame.index++;
+      const bool is_array = frame.keys.IsEmpty();
+      std::string key;
+      v8::Local<v8::Value> child;
+      if (is_array) {
+        // Holes become null, like in JSON.stringify.
+        if (!frame.object->HasRealIndexedProperty(frame.context, index)
+                 .FromMaybe(false)) {
+          Add(std::move(key), base::Value());
+          continue;
+        }
+        child = Get(frame.object->Get(frame.context, index));
+      } else {
+        v8::Local<v8::Value> name;
+        if (!frame.keys->Get(frame.context, index).ToLocal(&name) ||
+            !name->IsString()) {
+          try_catch_.Reset();
+          continue;
+        }
+        // Native accessors are left out, see crbug.com/139933.
+        if (frame.object
+                ->HasRealNamedCallbackProperty(frame.context,
+                                               name.As<v8::String>())
+                .FromMaybe(true)) {
+          try_catch_.Reset();
+          continue;
+        }
+        key = ToUTF8(isolate_, name.As<v8::String>());
+        child = Get(frame.object->Get(frame.context, name));
+      }
+
+      // Visiting a container pushes a frame, which invalidates |frame|.
+      base::Value out;
+      switch (Visit(child, &key, &out)) {
+        case Result::kSkip:
+          if (is_array)
+            Add(std::move(key), base::Value());
+          break;
+        case Result::kValue:
+          Add(std::move(key), std::move(out));
+          break;
+        case Result::kContainer:
+          break;
+      }
+    }
+  }
+
+ private:
+  enum class Result { kValue, kSkip, kContainer };
+
+  struct Frame {
+    v8::Local<v8::Object> object;
+    v8::Local<v8::Context> context;
+    // The object's own enumerable property names, empty for arrays.
+    v8::Local<v8::Array> keys;
+    uint32_t length = 0;
+    uint32_t index = 0;
+    // The dictionary or list being filled.
+    base::Value value;
+    // Where |value| goes in the parent.
+    std::string key;
+  };
+
+  // Stores a primitive in |out|, or pushes a frame for an object or array
+  // that takes over |key|.
+  Result Visit(v8::Local<v8::Value> value,
+               std::string* key,
+               base::Value* out) {
+    if (stack_.size() >= kMaxDepth)
+      return Result::kSkip;
+    if (value->IsNull()) {
+      *out = base::Value();
+      return Result::kValue;
+    }
+    if (value->IsBoolean()) {
+      *out = base::Value(value->IsTrue());
+      return Result::kValue;
+    }
+    if (value->IsInt32()) {
+      *out = base::Value(value.As<v8::Int32>()->Value());
+      return Result::kValue;
+    }
+    if (value->IsNumber()) {
+      const double number = value.As<v8::Number>()->Value();
+      if (!std::isfinite(number))
+        return Result::kSkip;
+      *out = base::Value(number);
+      return Result::kValue;
+    }
+    if (value->IsString()) {
+      *out = base::Value(ToUTF8(isolate_, value.As<v8::String>()));
+      return Result::kValue;
+    }
+    if (value->IsArrayBuffer()) {
+      v8::Local<v8::ArrayBuffer> buffer = value.As<v8::ArrayBuffer>();
+      const auto* data = static_cast<const uint8_t*>(buffer->Data());
+      *out = base::Value(base::Value::BlobStorage(
+          data, data + buffer->ByteLength()));
+      return Result::kValue;
+    }
+    if (value->IsArrayBufferView()) {
+      v8::Local<v8::ArrayBufferView> view = value.As<v8::ArrayBufferView>();
+      base::Value::BlobStorage bytes(view->ByteLength());
+      view->CopyContents(bytes.data(), bytes.size());
+      *out = base::Value(std::move(bytes));
+      return Result::kValue;
+    }
+    if (!value->IsObject() || value->IsFunction())
+      return Result::kSkip;
+
+    v8::Local<v8::Object> object = value.As<v8::Object>();
+    for (const Frame& ancestor : stack_) {
+      if (ancestor.object == object) {
+        *out = base::Value();
+        return Result::kValue;
+      }
+    }
+    // Host objects, e.g. DOM nodes or our own API objects, have nothing that
+    // could be converted.
+    if (object->InternalFieldCount()) {
+      *out = base::Value(base::Value::Dict());
+      return Result::kValue;
+    }
+
+    Frame frame;
+    frame.object = object;
+    // Objects without a creation context, e.g. remote objects or those of
+    // some API objects, are read in the current context instead.
+    if (!object->GetCreationContext().ToLocal(&frame.context))
+      frame.context = isolate_->GetCurrentContext();
+    frame.key = std::move(*key);
+    if (value->IsArray()) {
+      frame.length = value.As<v8::Array>()->Length();
+      frame.value = base::Value(base::Value::List());
+    } else {
+      if (!object
+               ->GetOwnPropertyNames(
+                   frame.context,
+                   static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE |
+                                                   v8::SKIP_SYMBOLS),
+                   v8::KeyConversionMode::kConvertToString)
+               .ToLocal(&frame.keys)) {
+        try_catch_.Reset();
+        *out = base::Value(base::Value::Dict());
+        return Result::kValue;
+      }
+      frame.length = frame.keys->Length();
+      frame.value = base::Value(base::Value::Dict());
+    }
+    stack_.push_back(std::move(frame));
+    return Result::kContainer;
+  }
+
+  // Getters that throw produce null.
+  v8::Local<v8::Value> Get(v8::MaybeLocal<v8::Value> maybe_value) {
+    v8::Local<v8::Value> value;
+    if (!maybe_value.ToLocal(&value)) {
+      try_catch_.Reset();
+      return v8::Null(isolate_);
+    }
+    return value;
+  }
+
+  // Adds |value| to the innermost container.
+  void Add(std::string key, base::Value value) {
+    base::Value& container = stack_.back().value;
+    if (container.is_list())
+      container.GetList().Append(std::move(value));
+    else
+      container.GetDict().Set(std::move(key), std::move(value));
+  }
+
+  raw_ptr<v8::Isolate> isolate_;
+  v8::TryCatch try_catch_;
+  std::vector<Frame> stack_;
+};
+
+class ValueToV8Converter {
+ public:
+  explicit ValueToV8Converter(v8::Isolate* isolate)
+      : isolate_{isolate}, context_{isolate->GetCurrentContext()} {}
+
+  // disable copy
+  ValueToV8Converter(const ValueToV8Converter&) = delete;
+  ValueToV8Converter& operator=(const ValueToV8Converter&) = delete;
+
+  v8::Local<v8::Value> Convert(base::ValueView value) {
+    v8::Local<v8::Value> root = value.Visit(Visitor{this});
+    while (!stack_.empty()) {
+      Frame& frame = stack_.back();
+      // Visiting a container pushes a frame, which invalidates |frame|.
+      v8::Local<v8::Object> object = frame.object;
+      if (frame.is_list) {
+        if (frame.list_it == frame.list_end) {
+          stack_.pop_back();
+          continue;
+        }
+        const uint32_t index = frame.index++;
+        const base::Value& child = *frame.list_it++;
+        v8::Local<v8::Value> child_v8 =
+            base::ValueView(child).Visit(Visitor{this});
+        std::ignore = object->CreateDataProperty(context_, index, child_v8);
+      } else {
+        if (frame.dict_it == frame.dict_end) {
+          stack_.pop_back();
+          continue;
+        }
+        const auto& [key, child] = *frame.dict_it++;
+        v8::Local<v8::String> key_v8 = Key(key);
+        v8::Local<v8::Value> child_v8 =
+            base::ValueView(child).Visit(Visitor{this});
+        std::ignore = object->CreateDataProperty(context_, key_v8, child_v8);
+      }
+    }
+    return root;
+  }
+
+ private:
+  struct Frame {
+    v8::Local<v8::Object> object;
+    bool is_list = false;
+    base::Value::Dict::const_iterator dict_it;
+    base::Value::Dict::const_iterator dict_end;
+    base::Value::List::const_iterator list_it;
+    base::Value::List::const_iterator list_end;
+    uint32_t index = 0;
+  };
+
+  // Creates primitives, and empty objects and arrays along with the frame
+  // that fills them.
+  struct Visitor {
+    raw_ptr<ValueToV8Converter> converter;
+
+    v8::Local<v8::Value> operator()(std::monostate) {
+      return v8::Null(converter->isolate_);
+    }
+    v8::Local<v8::Value> operator()(bool value) {
+      return v8::Boolean::New(converter->isolate_, value);
+    }
+    v8::Local<v8::Value> operator()(int value) {
+      return v8::Integer::New(converter->isolate_, value);
+    }
+    v8::Local<v8::Value> operator()(double value) {
+      return v8::Number::New(converter->isolate_, value);
+    }
+    v8::Local<v8::Value> operator()(std::string_view value) {
+      return v8::String::NewFromUtf8(converter->isolate_, value.data(),
+                                     v8::NewStringType::kNormal, value.size())
+          .ToLocalChecked();
+    }
+    v8::Local<v8::Value> operator()(const base::Value::BlobStorage& value) {
+      v8::Local<v8::ArrayBuffer> buffer =
+          v8::ArrayBuffer::New(converter->isolate_, value.size());
+      if (!value.empty())
+        memcpy(buffer->Data(), value.data(), value.size());
+      return buffer;
+    }
+    v8::Local<v8::Value> operator()(const base::Value::Dict& value) {
+      v8::Local<v8::Object> object = v8::Object::New(converter->isolate_);
+      Frame frame;
+      frame.object = object;
+      frame.dict_it = value.begin();
+      frame.dict_end = value.end();
+      converter->stack_.push_back(frame);
+      return object;
+    }
+    v8::Local<v8::Value> operator()(const base::Value::List& value) {
+      v8::Local<v8::Array> array =
+          v8::Array::New(converter->isolate_, static_cast<int>(value.size()));
+      Frame frame;
+      frame.object = array;
+      frame.is_list = true;
+      frame.list_it = value.begin();
+      frame.list_end = value.end();
+      converter->stack_.push_back(frame);
+      return array;
+    }
+  };
+
+  // Objects converted from the same kind of dictionary then share their keys
+  // and, as long as the keys come in the same order, their hidden class.
+  v8::Local<v8::String> Key(std::string_view key) {
+    if (auto it = keys_.find(key); it != keys_.end())
+      return it->second;
+    v8::Local<v8::String> key_v8 =
+        v8::String::NewFromUtf8(isolate_, key.data(),
+                                v8::NewStringType::kInternalized, key.size())
+            .ToLocalChecked();
+    if (keys_.size() < kMaxCachedKeys)
+      keys_.emplace(key, key_v8);
+    return key_v8;
+  }
+
+  raw_ptr<v8::Isolate> isolate_;
+  v8::Local<v8::Context> context_;
+  std::vector<Frame> stack_;
+  // Views into the value being converted, which outlives the converter.
+  base::flat_map<std::string_view, v8::Local<v8::String>> keys_;
+};
+
+}  // namespace
+
 bool Converter<base::Value::Dict>::FromV8(v8::Isolate* isolate,
                                           v8::Local<v8::Value> val,
                                           base::Value::Dict* out) {
-  std::unique_ptr<base::Value> value =
-      content::V8ValueConverter::Create()->FromV8Value(
-          val, isolate->GetCurrentContext());
+  std::optional<base::Value> value = V8ToValueConverter(isolate).Convert(val);
   if (value && value->is_dict()) {
     *out = std::move(*value).TakeDict();
     return true;
@@ -28,9 +398,7 @@ bool Converter<base::Value::Dict>::FromV8(v8::Isolate* isolate,
 bool Converter<base::Value>::FromV8(v8::Isolate* isolate,
                                     v8::Local<v8::Value> val,
                                     base::Value* out) {
-  std::unique_ptr<base::Value> value =
-      content::V8ValueConverter::Create()->FromV8Value(
-          val, isolate->GetCurrentContext());
+  std::optional<base::Value> value = V8ToValueConverter(isolate).Convert(val);
   if (value) {
     *out = std::move(*value);
     return true;
@@ -42,16 +410,13 @@ bool Converter<base::Value>::FromV8(v8::Isolate* isolate,
 v8::Local<v8::Value> Converter<base::ValueView>::ToV8(
     v8::Isolate* isolate,
     const base::ValueView val) {
-  return content::V8ValueConverter::Create()->ToV8Value(
-      val, isolate->GetCurrentContext());
+  return ValueToV8Converter(isolate).Convert(val);
 }
 
 bool Converter<base::Value::List>::FromV8(v8::Isolate* isolate,
                                           v8::Local<v8::Value> val,
                                           base::Value::List* out) {
-  std::unique_ptr<base::Value> value =
-      content::V8ValueConverter::Create()->FromV8Value(
-          val, isolate->GetCurrentContext());
+  std::optional<base::Value> value = V8ToValueConverter(isolate).Convert(val);
   if (value && value->is_list()) {
     *out = std::move(*value).TakeList();
     return true;
@@ -0,0 +1,64 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/ipc_channel_interner.h"
+
+#include <utility>
+
+namespace electron {
+
+IPCChannelInterner::IPCChannelInterner() = default;
+
+IPCChannelInterner::~IPCChannelInterner() = default;
+
+mojom::IPCChannelPtr IPCChannelInterner::Intern(std::string_view name) {
+  if (auto it = ids_.find(name); it != ids_.end())
+    return mojom::IPCChannel::New(it->second, std::nullopt);
+
+  if (ids_.size() >= kMaxChannels)
+    return mojom::IPCChannel::New(0, std::string(name));
+
+  uint32_t id = ids_.size() + 1;
+  ids_.emplace(name, id);
+  return mojom::IPCChannel::New(id, std::string(name));
+}
+
+void IPCChannelInterner::Reset() {
+  ids_.clear();
+}
+
+IPCChannelResolver::IPCChannelResolver() = default;
+
+IPCChannelResolver::~IPCChannelResolver() = default;
+
+const std::string* IPCChannelResolver::Resolve(
+    const mojom::IPCChannelPtr& channel) {
+  if (!channel)
+    return nullptr;
+
+  if (channel->id == 0) {
+    if (!channel->name)
+      return nullptr;
+    return &*channel->name;
+  }
+
+  size_t index = channel->id - 1;
+  if (channel->name) {
+    // A new channel must take the next ID.
+    if (index != names_.size() ||
+        names_.size() >= IPCChannelInterner::kMaxChannels)
+      return nullptr;
+    names_.push_back(*channel->name);
+  }
+
+  if (index >= names_.size())
+    return nullptr;
+  return &names_[index];
+}
+
+void IPCChannelResolver::Reset() {
+  names_.clear();
+}
+
+}  // namespace electron
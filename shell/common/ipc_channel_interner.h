@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_IPC_CHANNEL_INTERNER_H_
+#define ELECTRON_SHELL_COMMON_IPC_CHANNEL_INTERNER_H_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "base/containers/flat_map.h"
+#include "electron/shell/common/api/api.mojom.h"
+
+namespace electron {
+
+// Turns the channel names sent over one IPC connection into small IDs.
+//
+// The first message that uses a channel carries its name together with the
+// next free ID, and later messages only carry the ID, which the receiving
+// IPCChannelResolver maps back to the name. Both ends must be reset whenever
+// the connection is, since the IDs are only meaningful on a single pipe.
+class IPCChannelInterner {
+ public:
+  // Past this many channels, names are sent as is rather than interned, so
+  // that a page generating channel names cannot grow the tables forever.
+  static constexpr size_t kMaxChannels = 4096;
+
+  IPCChannelInterner();
+  ~IPCChannelInterner();
+
+  // disable copy
+  IPCChannelInterner(const IPCChannelInterner&) = delete;
+  IPCChannelInterner& operator=(const IPCChannelInterner&) = delete;
+
+  mojom::IPCChannelPtr Intern(std::string_view name);
+
+  void Reset();
+
+ private:
+  base::flat_map<std::string, uint32_t, std::less<>> ids_;
+};
+
+// The receiving end of an IPCChannelInterner.
+class IPCChannelResolver {
+ public:
+  IPCChannelResolver();
+  ~IPCChannelResolver();
+
+  // disable copy
+  IPCChannelResolver(const IPCChannelResolver&) = delete;
+  IPCChannelResolver& operator=(const IPCChannelResolver&) = delete;
+
+  // Returns the name |channel| refers to, or nullptr if the sender did not
+  // follow the protocol, in which case the message should be reported as
+  // bad. The name stays valid while |channel| is alive and until Reset(),
+  // including across messages dispatched from nested run loops.
+  const std::string* Resolve(const mojom::IPCChannelPtr& channel);
+
+  void Reset();
+
+ private:
+  // Names indexed by ID - 1, as IDs are handed out sequentially. Unlike
+  // base::circular_deque, std::deque keeps the names in place as new ones
+  // are added.
+  std::deque<std::string> names_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_IPC_CHANNEL_INTERNER_H_
@@ -0,0 +1,165 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/main_thread_profiler.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+#include "base/location.h"
+#include "base/pending_task.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/current_thread.h"
+
+namespace electron {
+
+namespace {
+
+MainThreadProfiler* g_profiler = nullptr;
+
+// Beyond this many distinct tags, new tags are only recorded by category so
+// that e.g. a renderer inventing IPC channel names cannot grow the profiler
+// without bound.
+constexpr size_t kMaxTags = 1000;
+
+}  // namespace
+
+MainThreadProfiler::ScopedTag::ScopedTag(std::string_view category,
+                                         std::string_view detail) {
+  MainThreadProfiler* profiler = g_profiler;
+  if (!profiler || profiler->thread_ != base::PlatformThread::CurrentRef())
+    return;
+  active_ = true;
+  profiler->Push(profiler->InternTag(category, detail));
+}
+
+MainThreadProfiler::ScopedTag::~ScopedTag() {
+  if (active_ && g_profiler)
+    g_profiler->Pop();
+}
+
+MainThreadProfiler::MainThreadProfiler()
+    : thread_{base::PlatformThread::CurrentRef()},
+      start_time_{base::TimeTicks::Now()} {
+  DCHECK(!g_profiler);
+  g_profiler = this;
+  base::CurrentThread::Get()->AddTaskObserver(this);
+}
+
+MainThreadProfiler::~MainThreadProfiler() {
+  base::CurrentThread::Get()->RemoveTaskObserver(this);
+  g_profiler = nullptr;
+}
+
+// static
+MainThreadProfiler* MainThreadProfiler::Get() {
+  return g_profiler;
+}
+
+std::vector<MainThreadProfiler::Entry> MainThreadProfiler::GetTopEntries(
+    base::TimeDelta duration,
+    size_t count) const {
+  const int64_t now =
+      (base::TimeTicks::Now() - start_time_).IntDiv(base::Seconds(1));
+  const int64_t windows = std::clamp<int64_t>(
+      duration.IntDiv(base::Seconds(1)), 1, static_cast<int64_t>(kWindowCount));
+
+  base::flat_map<Key, Stats> totals;
+  for (const Window& window : windows_) {
+    if (window.index < 0 || window.index <= now - windows)
+      continue;
+    for (const auto& [key, stats] : window.stats) {
+      Stats& total = totals[key];
+      total.count += stats.count;
+      total.total_time += stats.total_time;
+      total.max_time = std::max(total.max_time, stats.max_time);
+    }
+  }
+
+  std::vector<Entry> entries;
+  entries.reserve(totals.size());
+  for (const auto& [key, stats] : totals) {
+    const auto& [name, location] = names_.at(key);
+    entries.push_back(
+        {name, location, stats.count, stats.total_time, stats.max_time});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) {
+              return a.total_time > b.total_time;
+            });
+  if (entries.size() > count)
+    entries.resize(count);
+  return entries;
+}
+
+void MainThreadProfiler::WillProcessTask(const base::PendingTask& pending_task,
+                                         bool was_blocked_or_low_priority) {
+  const base::Location& from = pending_task.posted_from;
+  // The program counter is only recorded in some build configurations, the
+  // file name is a string literal and as such unique enough.
+  Key key = from.program_counter() ? from.program_counter()
+                                   : static_cast<Key>(from.file_name());
+  if (!names_.contains(key)) {
+    names_.emplace(
+        key, std::pair(from.function_name() ? from.function_name() : "unknown",
+                       from.file_name()
+                           ? base::StrCat({from.file_name(), ":",
+                                           base::NumberToString(
+                                               from.line_number())})
+                           : std::string()));
+  }
+  Push(key);
+}
+
+void MainThreadProfiler::DidProcessTask(const base::PendingTask& pending_task) {
+  Pop();
+}
+
+void MainThreadProfiler::Push(Key key) {
+  stack_.push_back({key, base::TimeTicks::Now(), base::TimeDelta()});
+}
+
+void MainThreadProfiler::Pop() {
+  if (stack_.empty())
+    return;
+  const Frame frame = stack_.back();
+  stack_.pop_back();
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const base::TimeDelta elapsed = now - frame.start;
+  if (!stack_.empty())
+    stack_.back().nested_time += elapsed;
+
+  const int64_t index = (now - start_time_).IntDiv(base::Seconds(1));
+  Window& window = windows_[index % kWindowCount];
+  if (window.index != index) {
+    window.index = index;
+    window.stats.clear();
+  }
+  const base::TimeDelta self_time = elapsed - frame.nested_time;
+  Stats& stats = window.stats[frame.key];
+  stats.count++;
+  stats.total_time += self_time;
+  stats.max_time = std::max(stats.max_time, self_time);
+}
+
+const std::string* MainThreadProfiler::InternTag(std::string_view category,
+                                                 std::string_view detail) {
+  auto it = tags_.find(TagKey(category, detail));
+  if (it == tags_.end()) {
+    if (tags_.size() >= kMaxTags && !detail.empty())
+      return InternTag(category, std::string_view());
+    std::string name = detail.empty() ? std::string(category)
+                                      : base::StrCat({category, ":", detail});
+    it = tags_
+             .emplace(std::pair(std::string(category), std::string(detail)),
+                      std::move(name))
+             .first;
+    names_.emplace(&it->second, std::pair(it->second, std::string()));
+  }
+  return &it->second;
+}
+
+}  // namespace electron
@@ -0,0 +1,129 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_MAIN_THREAD_PROFILER_H_
+#define ELECTRON_SHELL_COMMON_MAIN_THREAD_PROFILER_H_
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/task/task_observer.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+
+namespace electron {
+
+// Buckets the time spent running tasks on the thread it is created on by
+// the location the tasks were posted from, over a rolling window of
+// |kWindowCount| one second windows. Code that runs on behalf of something
+// more meaningful than its posting location, e.g. an IPC channel or a
+// webRequest listener, can attribute its time to a tag with ScopedTag. That
+// time is then subtracted from the enclosing task or tag, so that every
+// microsecond is only accounted for once.
+class MainThreadProfiler : public base::TaskObserver {
+ public:
+  static constexpr size_t kWindowCount = 60;
+
+  struct Entry {
+    std::string name;
+    // "file:line" of the posting location, empty for tags.
+    std::string location;
+    uint64_t count = 0;
+    base::TimeDelta total_time;
+    base::TimeDelta max_time;
+  };
+
+  // Attributes the time until it goes out of scope to "category:detail".
+  // Does nothing when there is no profiler on the current thread.
+  class ScopedTag {
+   public:
+    explicit ScopedTag(std::string_view category,
+                       std::string_view detail = std::string_view());
+    ~ScopedTag();
+
+    // disable copy
+    ScopedTag(const ScopedTag&) = delete;
+    ScopedTag& operator=(const ScopedTag&) = delete;
+
+   private:
+    bool active_ = false;
+  };
+
+  MainThreadProfiler();
+  ~MainThreadProfiler() override;
+
+  // disable copy
+  MainThreadProfiler(const MainThreadProfiler&) = delete;
+  MainThreadProfiler& operator=(const MainThreadProfiler&) = delete;
+
+  static MainThreadProfiler* Get();
+
+  // The |count| entries with the most time over the last |duration|.
+  std::vector<Entry> GetTopEntries(base::TimeDelta duration,
+                                   size_t count) const;
+
+  // base::TaskObserver:
+  void WillProcessTask(const base::PendingTask& pending_task,
+                       bool was_blocked_or_low_priority) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+ private:
+  // Identifies a bucket: the program counter of a posting location, or the
+  // interned name of a tag.
+  using Key = const void*;
+
+  struct Stats {
+    uint64_t count = 0;
+    base::TimeDelta total_time;
+    base::TimeDelta max_time;
+  };
+
+  struct Window {
+    int64_t index = -1;
+    base::flat_map<Key, Stats> stats;
+  };
+
+  struct Frame {
+    Key key;
+    base::TimeTicks start;
+    // Time spent in tags and nested tasks, which is accounted elsewhere.
+    base::TimeDelta nested_time;
+  };
+
+  // Orders tags by category and detail, and allows looking them up without
+  // copying the strings.
+  struct TagLess {
+    using is_transparent = void;
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      return std::tie(a.first, a.second) < std::tie(b.first, b.second);
+    }
+  };
+  using TagKey = std::pair<std::string_view, std::string_view>;
+
+  void Push(Key key);
+  void Pop();
+  const std::string* InternTag(std::string_view category,
+                               std::string_view detail);
+
+  const base::PlatformThreadRef thread_;
+  const base::TimeTicks start_time_;
+  std::array<Window, kWindowCount> windows_;
+  std::vector<Frame> stack_;
+
+  // Names of the buckets, by key.
+  std::map<Key, std::pair<std::string, std::string>> names_;
+  std::map<std::pair<std::string, std::string>, std::string, TagLess> tags_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_MAIN_THREAD_PROFILER_H_
@@ -35,8 +35,10 @@
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
 #include "shell/common/mac/main_application_bundle.h"
+#include "shell/common/main_thread_profiler.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
+#include "shell/common/startup_profile.h"
 #include "shell/common/world_ids.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_initializer.h"  // nogncheck
@@ -597,6 +599,7 @@ std::shared_ptr<node::Environment> NodeBindings::CreateEnvironment(
     std::vector<std::string> args,
     std::vector<std::string> exec_args,
     std::optional<base::RepeatingCallback<void()>> on_app_code_ready) {
+  ScopedStartupPhase startup_phase("NodeBindings::CreateEnvironment");
   // Feed node the path to initialization script.
   std::string process_type;
   switch (browser_env_) {
@@ -809,6 +812,7 @@ std::shared_ptr<node::Environment> NodeBindings::CreateEnvironment(
 }
 
 void NodeBindings::LoadEnvironment(node::Environment* env) {
+  ScopedStartupPhase startup_phase("NodeBindings::LoadEnvironment");
   node::LoadEnvironment(env, node::StartExecutionCallback{}, &OnNodePreload);
   gin_helper::EmitEvent(env->isolate(), env->process_object(), "loaded");
 }
@@ -888,6 +892,8 @@ void NodeBindings::UvRunOnce() {
   if (!env)
     return;
 
+  MainThreadProfiler::ScopedTag profiler_tag("node", "uvRunOnce");
+
   v8::HandleScope handle_scope(env->isolate());
 
   // Enter node context while dealing with uv events.
@@ -258,6 +258,9 @@ const char kEnableAuthNegotiatePort[] = "enable-auth-negotiate-port";
 // If set, NTLM v2 is disabled for POSIX platforms.
 const char kDisableNTLMv2[] = "disable-ntlm-v2";
 
+// Directory of decompressed resources shared between processes.
+const char kResourceCacheDir[] = "resource-cache-dir";
+
 }  // namespace switches
 
 }  // namespace electron
@@ -126,6 +126,7 @@ extern const char kAuthServerWhitelist[];
 extern const char kAuthNegotiateDelegateWhitelist[];
 extern const char kEnableAuthNegotiatePort[];
 extern const char kDisableNTLMv2[];
+extern const char kResourceCacheDir[];
 }  // namespace switches
 
 }  // namespace electron
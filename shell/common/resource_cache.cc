@@ -0,0 +1,249 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/resource_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ptr_util.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "crypto/secure_hash.h"
+#include "crypto/sha2.h"
+#include "ui/base/resource/resource_bundle.h"
+
+namespace electron {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x43524c45;  // "ELRC"
+constexpr uint32_t kFormatVersion = 1;
+
+// Resource ids of a pak are 16 bits wide.
+constexpr int kMaxResourceId = std::numeric_limits<uint16_t>::max();
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t count;
+  uint32_t reserved;
+  uint64_t index_offset;
+  uint64_t size;
+  // SHA-256 of everything after the header.
+  uint8_t checksum[crypto::kSHA256Length];
+};
+static_assert(sizeof(Header) == 64);
+
+struct IndexEntry {
+  uint32_t id;
+  uint32_t reserved;
+  uint64_t offset;
+  uint64_t length;
+};
+static_assert(sizeof(IndexEntry) == 24);
+
+bool IsCompressed(ui::ResourceBundle& bundle, int resource_id) {
+  return bundle.IsGzipped(resource_id) || bundle.IsBrotli(resource_id);
+}
+
+}  // namespace
+
+class ResourceCache::Mapping {
+ public:
+  static std::unique_ptr<Mapping> Create(base::File file,
+                                         bool verify_checksum) {
+    auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+    if (!mapped_file->Initialize(std::move(file)))
+      return nullptr;
+
+    const base::span<const uint8_t> bytes = mapped_file->bytes();
+    if (bytes.size() < sizeof(Header))
+      return nullptr;
+    Header header;
+    memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != kMagic || header.version != kFormatVersion ||
+        header.size != bytes.size() || header.index_offset < sizeof(Header) ||
+        header.index_offset > header.size ||
+        header.index_offset % alignof(IndexEntry) != 0 ||
+        header.size - header.index_offset !=
+            uint64_t{header.count} * sizeof(IndexEntry)) {
+      return nullptr;
+    }
+
+    const base::span<const IndexEntry> index(
+        reinterpret_cast<const IndexEntry*>(bytes.data() +
+                                            header.index_offset),
+        header.count);
+    for (size_t i = 0; i < index.size(); ++i) {
+      const IndexEntry& entry = index[i];
+      if ((i > 0 && entry.id <= index[i - 1].id) ||
+          entry.offset < sizeof(Header) ||
+          entry.offset > header.index_offset ||
+          entry.length > header.index_offset - entry.offset) {
+        return nullptr;
+      }
+    }
+
+    if (verify_checksum) {
+      const base::span<const uint8_t> payload = bytes.subspan(sizeof(Header));
+      const std::string checksum = crypto::SHA256HashString(std::string_view(
+          reinterpret_cast<const char*>(payload.data()), payload.size()));
+      if (memcmp(checksum.data(), header.checksum, sizeof(header.checksum)))
+        return nullptr;
+    }
+
+    return base::WrapUnique(new Mapping(std::move(mapped_file), index));
+  }
+
+  // disable copy
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+
+  size_t size() const { return index_.size(); }
+
+  base::span<const uint8_t> Find(int resource_id) const {
+    auto it = std::lower_bound(index_.begin(), index_.end(), resource_id,
+                               [](const IndexEntry& entry, int id) {
+                                 return static_cast<int>(entry.id) < id;
+                               });
+    if (it == index_.end() || static_cast<int>(it->id) != resource_id)
+      return {};
+    return file_->bytes().subspan(it->offset, it->length);
+  }
+
+ private:
+  Mapping(std::unique_ptr<base::MemoryMappedFile> file,
+          base::span<const IndexEntry> index)
+      : file_{std::move(file)}, index_{index} {}
+
+  const std::unique_ptr<base::MemoryMappedFile> file_;
+  const base::span<const IndexEntry> index_;
+};
+
+// static
+ResourceCache* ResourceCache::Get() {
+  static base::NoDestructor<ResourceCache> cache;
+  return cache.get();
+}
+
+ResourceCache::ResourceCache() = default;
+
+ResourceCache::~ResourceCache() {
+  delete mapping_.load(std::memory_order_acquire);
+}
+
+bool ResourceCache::Attach(base::File file, bool verify_checksum) {
+  if (mapping_.load(std::memory_order_acquire))
+    return false;
+  std::unique_ptr<Mapping> mapping =
+      Mapping::Create(std::move(file), verify_checksum);
+  if (!mapping)
+    return false;
+  const Mapping* expected = nullptr;
+  if (!mapping_.compare_exchange_strong(expected, mapping.get(),
+                                        std::memory_order_acq_rel)) {
+    return false;
+  }
+  mapping.release();
+  return true;
+}
+
+base::RefCountedMemory* ResourceCache::Load(int resource_id) const {
+  const Mapping* mapping = mapping_.load(std::memory_order_acquire);
+  if (!mapping)
+    return nullptr;
+  const base::span<const uint8_t> data = mapping->Find(resource_id);
+  if (data.empty())
+    return nullptr;
+  load_count_.fetch_add(1, std::memory_order_relaxed);
+  // The mapping is never replaced, so it outlives the returned object.
+  return new base::RefCountedStaticMemory(data);
+}
+
+size_t ResourceCache::GetResourceCountForTesting() const {
+  const Mapping* mapping = mapping_.load(std::memory_order_acquire);
+  return mapping ? mapping->size() : 0;
+}
+
+size_t ResourceCache::GetLoadCountForTesting() const {
+  return load_count_.load(std::memory_order_relaxed);
+}
+
+// static
+std::string ResourceCache::GetFileName() {
+  ui::ResourceBundle& bundle = ui::ResourceBundle::GetSharedInstance();
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  hash->Update(&kFormatVersion, sizeof(kFormatVersion));
+  for (int id = 0; id <= kMaxResourceId; ++id) {
+    if (!IsCompressed(bundle, id))
+      continue;
+    const std::string_view data = bundle.GetRawDataResource(id);
+    const uint32_t id32 = id;
+    hash->Update(&id32, sizeof(id32));
+    hash->Update(data.data(), data.size());
+  }
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+  return base::ToLowerASCII(base::HexEncode(digest, 16)) + ".resources";
+}
+
+// static
+bool ResourceCache::Write(const base::FilePath& path) {
+  base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                            base::File::FLAG_WRITE);
+  if (!file.IsValid())
+    return false;
+
+  ui::ResourceBundle& bundle = ui::ResourceBundle::GetSharedInstance();
+  std::unique_ptr<crypto::SecureHash> checksum =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  auto append = [&](base::span<const uint8_t> data, uint64_t* offset) {
+    if (!file.WriteAndCheck(*offset, data))
+      return false;
+    checksum->Update(data.data(), data.size());
+    *offset += data.size();
+    return true;
+  };
+
+  std::vector<IndexEntry> index;
+  uint64_t offset = sizeof(Header);
+  for (int id = 0; id <= kMaxResourceId; ++id) {
+    if (!IsCompressed(bundle, id))
+      continue;
+    scoped_refptr<base::RefCountedMemory> data =
+        bundle.LoadDataResourceBytes(id);
+    if (!data)
+      continue;
+    index.push_back({static_cast<uint32_t>(id), 0, offset, data->size()});
+    if (!append(data->AsSpan(), &offset))
+      return false;
+  }
+
+  static constexpr uint8_t kPadding[alignof(IndexEntry)] = {};
+  const uint64_t padding = -offset % alignof(IndexEntry);
+  if (!append(base::span(kPadding).first(padding), &offset))
+    return false;
+  const uint64_t index_offset = offset;
+  if (!append(base::as_byte_span(index), &offset))
+    return false;
+
+  Header header = {kMagic, kFormatVersion, static_cast<uint32_t>(index.size()),
+                   0,      index_offset,   offset};
+  checksum->Finish(header.checksum, sizeof(header.checksum));
+  return file.WriteAndCheck(0, base::byte_span_from_ref(header));
+}
+
+}  // namespace electron
@@ -0,0 +1,75 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_RESOURCE_CACHE_H_
+#define ELECTRON_SHELL_COMMON_RESOURCE_CACHE_H_
+
+#include <atomic>
+#include <string>
+
+#include "base/files/file.h"
+#include "base/memory/ref_counted_memory.h"
+
+namespace base {
+class FilePath;
+}
+
+namespace electron {
+
+// A file of decompressed pak resources, built once per app and build by the
+// browser process and handed to renderers as a read-only file handle. Every
+// process maps the same file, so the decompressed pages are shared between
+// them instead of being decompressed into private memory by each one.
+//
+// The file starts with a header, followed by the resources themselves and an
+// index of them sorted by resource id. Only compressed resources are in the
+// file: reading the others from the pak is as cheap as it gets.
+class ResourceCache {
+ public:
+  static ResourceCache* Get();
+
+  ResourceCache();
+  ~ResourceCache();
+
+  // disable copy
+  ResourceCache(const ResourceCache&) = delete;
+  ResourceCache& operator=(const ResourceCache&) = delete;
+
+  // Maps |file| and serves resources from it from now on. Only the first
+  // file that is attached is used. The layout of the file is always checked,
+  // and its checksum too if |verify_checksum| is set, which reads the whole
+  // file. Returns false if the file is not usable. May block.
+  bool Attach(base::File file, bool verify_checksum);
+
+  // Returns the decompressed bytes of |resource_id|, following the contract
+  // of ui::ResourceBundle::LoadDataResourceBytes: the result is a new object
+  // for the caller to adopt. Returns nullptr if no file is attached or the
+  // resource is not in it. Does not block or take locks.
+  base::RefCountedMemory* Load(int resource_id) const;
+
+  // The number of resources in the attached file, and the number of times one
+  // of them has been served by Load(), for tests.
+  size_t GetResourceCountForTesting() const;
+  size_t GetLoadCountForTesting() const;
+
+  // Returns a name for the cache file of the resources of the shared
+  // ui::ResourceBundle, which changes whenever any of them does.
+  static std::string GetFileName();
+
+  // Writes every compressed resource of the shared ui::ResourceBundle,
+  // decompressed, to a new cache file at |path|. May block for a while.
+  static bool Write(const base::FilePath& path);
+
+ private:
+  class Mapping;
+
+  // Set once by Attach(), and never changed after that.
+  std::atomic<const Mapping*> mapping_{nullptr};
+
+  mutable std::atomic<size_t> load_count_{0};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_RESOURCE_CACHE_H_
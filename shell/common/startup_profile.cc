@@ -0,0 +1,81 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/startup_profile.h"
+
+#include "base/no_destructor.h"
+#include "base/process/process.h"
+#include "base/trace_event/trace_event.h"
+
+namespace electron {
+
+namespace {
+
+// Maps process launch onto the monotonic clock so that phase offsets read as
+// "milliseconds since launch". Falls back to the time of first use when the
+// platform cannot tell us when the process was created.
+base::Time GetOriginTime() {
+  base::Time creation_time = base::Process::Current().CreationTime();
+  return creation_time.is_null() ? base::Time::Now() : creation_time;
+}
+
+}  // namespace
+
+// static
+StartupProfile* StartupProfile::GetInstance() {
+  static base::NoDestructor<StartupProfile> instance;
+  return instance.get();
+}
+
+StartupProfile::StartupProfile()
+    : origin_time_{GetOriginTime()},
+      origin_ticks_{base::TimeTicks::Now() -
+                    (base::Time::Now() - origin_time_)} {}
+
+StartupProfile::~StartupProfile() = default;
+
+void StartupProfile::AddPhase(const char* name,
+                              base::TimeTicks start,
+                              base::TimeTicks end) {
+  base::AutoLock auto_lock(lock_);
+  if (phases_.size() < kMaxPhases)
+    phases_.push_back({name, start, end});
+}
+
+void StartupProfile::Mark(const char* name) {
+  TRACE_EVENT_INSTANT0("electron", name, TRACE_EVENT_SCOPE_PROCESS);
+  const base::TimeTicks now = base::TimeTicks::Now();
+  AddPhase(name, now, now);
+}
+
+base::Value::Dict StartupProfile::ToDict() const {
+  base::Value::List phases;
+  {
+    base::AutoLock auto_lock(lock_);
+    for (const auto& phase : phases_) {
+      phases.Append(
+          base::Value::Dict()
+              .Set("name", phase.name)
+              .Set("startTime", (phase.start - origin_ticks_).InMillisecondsF())
+              .Set("duration", (phase.end - phase.start).InMillisecondsF()));
+    }
+  }
+
+  return base::Value::Dict()
+      .Set("timeOrigin", origin_time_.InMillisecondsFSinceUnixEpoch())
+      .Set("phases", std::move(phases));
+}
+
+ScopedStartupPhase::ScopedStartupPhase(const char* name)
+    : name_{name}, start_{base::TimeTicks::Now()} {
+  TRACE_EVENT_BEGIN0("electron", name_);
+}
+
+ScopedStartupPhase::~ScopedStartupPhase() {
+  TRACE_EVENT_END0("electron", name_);
+  StartupProfile::GetInstance()->AddPhase(name_, start_,
+                                          base::TimeTicks::Now());
+}
+
+}  // namespace electron
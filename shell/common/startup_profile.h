@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_STARTUP_PROFILE_H_
+#define ELECTRON_SHELL_COMMON_STARTUP_PROFILE_H_
+
+#include <vector>
+
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace base {
+template <typename T>
+class NoDestructor;
+}
+
+namespace electron {
+
+// Collects high-resolution timestamps for the phases a process goes through
+// between launch and app readiness. Phases are recorded per-process and can
+// be read back as a machine readable profile with process.getStartupProfile().
+class StartupProfile {
+ public:
+  struct Phase {
+    const char* name;
+    base::TimeTicks start;
+    base::TimeTicks end;
+  };
+
+  static StartupProfile* GetInstance();
+
+  // disable copy
+  StartupProfile(const StartupProfile&) = delete;
+  StartupProfile& operator=(const StartupProfile&) = delete;
+
+  // |name| must be a string literal since it is stored without copying.
+  void AddPhase(const char* name, base::TimeTicks start, base::TimeTicks end);
+
+  // Records an instantaneous milestone, e.g. the app becoming ready.
+  void Mark(const char* name);
+
+  // Returns the profile as a dictionary of the form
+  // { timeOrigin, phases: [{ name, startTime, duration }] } where all times
+  // are in milliseconds and |startTime| is relative to |timeOrigin|.
+  base::Value::Dict ToDict() const;
+
+ private:
+  friend base::NoDestructor<StartupProfile>;
+
+  StartupProfile();
+  ~StartupProfile();
+
+  // The profile is only meant to cover startup, bound it so that late callers
+  // (e.g. archives opened long after launch) cannot grow it indefinitely.
+  static constexpr size_t kMaxPhases = 256;
+
+  const base::Time origin_time_;
+  const base::TimeTicks origin_ticks_;
+
+  mutable base::Lock lock_;
+  std::vector<Phase> phases_ GUARDED_BY(lock_);
+};
+
+// Records the lifetime of the enclosing scope as a startup phase and emits a
+// matching trace event in the "electron" category.
+class ScopedStartupPhase {
+ public:
+  explicit ScopedStartupPhase(const char* name);
+  ~ScopedStartupPhase();
+
+  // disable copy
+  ScopedStartupPhase(const ScopedStartupPhase&) = delete;
+  ScopedStartupPhase& operator=(const ScopedStartupPhase&) = delete;
+
+ private:
+  const char* name_;
+  const base::TimeTicks start_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_STARTUP_PROFILE_H_
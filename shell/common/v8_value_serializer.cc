@@ -4,6 +4,8 @@
 
 #include "shell/common/v8_value_serializer.h"
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -21,10 +23,73 @@ namespace electron {
 
 namespace {
 enum SerializationTag {
+  kPaddingTag = '\0',
+  kDenseArrayTag = 'A',
   kNativeImageTag = 'i',
+  kBeginJSObjectTag = '{',
+  kEndJSObjectTag = '}',
   kTrailerOffsetTag = 0xFE,
   kVersionTag = 0xFF
 };
+
+constexpr uint32_t kMinWireFormatVersionWithTrailer = 21;
+
+bool ReadVarint(base::span<const uint8_t> data,
+                size_t* offset,
+                uint32_t* value) {
+  *value = 0;
+  for (int shift = 0; shift < 32 && *offset < data.size(); shift += 7) {
+    const uint8_t byte = data[(*offset)++];
+    *value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+// V8 numbers the objects of a message in the order it reads them, and an
+// array gets its number before its elements are read, which the back
+// references among the elements count on. So that the elements can be read
+// without the array, this copies |data| with an empty object in place of the
+// start of the array, which then takes the number of the array. Returns an
+// empty vector if |data| does not hold a dense array.
+std::vector<uint8_t> ReplaceDenseArrayStart(base::span<const uint8_t> data,
+                                            uint32_t* length) {
+  size_t offset = 0;
+  uint32_t version;
+  if (offset >= data.size() || data[offset++] != kVersionTag ||
+      !ReadVarint(data, &offset, &version))
+    return {};
+  if (version >= kMinWireFormatVersionWithTrailer) {
+    // The trailer offset tag, then the offset and size of the trailer.
+    static constexpr size_t kTrailerOffsetSize =
+        1 + sizeof(uint64_t) + sizeof(uint32_t);
+    if (data.size() - offset < kTrailerOffsetSize ||
+        data[offset] != kTrailerOffsetTag)
+      return {};
+    offset += kTrailerOffsetSize;
+  }
+  if (offset >= data.size() || data[offset++] != kVersionTag ||
+      !ReadVarint(data, &offset, &version))
+    return {};
+  const size_t header_end = offset;
+
+  while (offset < data.size() && data[offset] == kPaddingTag)
+    ++offset;
+  if (offset >= data.size() || data[offset++] != kDenseArrayTag ||
+      !ReadVarint(data, &offset, length))
+    return {};
+
+  static constexpr uint8_t kEmptyObject[] = {kBeginJSObjectTag,
+                                             kEndJSObjectTag, 0};
+  std::vector<uint8_t> result;
+  result.reserve(header_end + sizeof(kEmptyObject) + data.size() - offset);
+  result.insert(result.end(), data.begin(), data.begin() + header_end);
+  result.insert(result.end(), std::begin(kEmptyObject), std::end(kEmptyObject));
+  result.insert(result.end(), data.begin() + offset, data.end());
+  return result;
+}
+
 }  // namespace
 
 class V8Serializer : public v8::ValueSerializer::Delegate {
@@ -142,6 +207,39 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     return scope.Escape(value);
   }
 
+  // Reads the first |count| of the |length| elements of a packed array from
+  // data prepared by ReplaceDenseArrayStart(), without decoding the rest.
+  v8::MaybeLocal<v8::Array> DeserializeArrayPrefix(size_t count,
+                                                   uint32_t length) {
+    v8::EscapableHandleScope scope(isolate_);
+    auto context = isolate_->GetCurrentContext();
+
+    uint32_t blink_version;
+    if (!ReadBlinkEnvelope(&blink_version))
+      return {};
+
+    bool read_header;
+    if (!deserializer_.ReadHeader(context).To(&read_header))
+      return {};
+    // The object that stands in for the array.
+    v8::Local<v8::Value> array;
+    if (!deserializer_.ReadValue(context).ToLocal(&array) ||
+        !array->IsObject())
+      return {};
+
+    // Holey arrays are also written as dense arrays, but V8 only skips their
+    // holes when decoding the whole array, in which case ReadValue() fails.
+    std::vector<v8::Local<v8::Value>> elements;
+    for (size_t i = 0; i < std::min<size_t>(count, length); ++i) {
+      v8::Local<v8::Value> element;
+      if (!deserializer_.ReadValue(context).ToLocal(&element))
+        return {};
+      elements.push_back(element);
+    }
+    return scope.Escape(
+        v8::Array::New(isolate_, elements.data(), elements.size()));
+  }
+
   v8::MaybeLocal<v8::Object> ReadHostObject(v8::Isolate* isolate) override {
     uint8_t tag = 0;
     if (!ReadTag(&tag))
@@ -173,7 +271,6 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
       return false;
     if (!deserializer_.ReadUint32(blink_version))
       return false;
-    static constexpr uint32_t kMinWireFormatVersionWithTrailer = 21;
     if (*blink_version >= kMinWireFormatVersionWithTrailer) {
       // In these versions, we expect kTrailerOffsetTag (0xFE) followed by an
       // offset and size. See details in
@@ -238,4 +335,37 @@ v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
   return V8Deserializer(isolate, data).Deserialize();
 }
 
+v8::Local<v8::Value> DeserializeV8ArrayPrefix(v8::Isolate* isolate,
+                                              const blink::CloneableMessage& in,
+                                              size_t count) {
+  v8::EscapableHandleScope scope(isolate);
+  uint32_t length = 0;
+  const std::vector<uint8_t> data =
+      ReplaceDenseArrayStart(in.encoded_message, &length);
+  if (!data.empty()) {
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Array> prefix;
+    if (V8Deserializer(isolate, data)
+            .DeserializeArrayPrefix(count, length)
+            .ToLocal(&prefix))
+      return scope.Escape(prefix);
+  }
+
+  // Fall back to decoding the whole value.
+  v8::Local<v8::Value> value = V8Deserializer(isolate, in).Deserialize();
+  auto context = isolate->GetCurrentContext();
+  std::vector<v8::Local<v8::Value>> elements;
+  if (value->IsArray()) {
+    v8::Local<v8::Array> array = value.As<v8::Array>();
+    for (uint32_t i = 0; i < std::min<size_t>(count, array->Length()); ++i) {
+      v8::Local<v8::Value> element;
+      if (!array->Get(context, i).ToLocal(&element))
+        break;
+      elements.push_back(element);
+    }
+  }
+  return scope.Escape(
+      v8::Array::New(isolate, elements.data(), elements.size()));
+}
+
 }  // namespace electron
@@ -29,6 +29,13 @@ v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data);
 
+// Returns an array holding the first |count| elements of the array serialized
+// in |in|. Only those elements are decoded if |in| holds a packed array, like
+// the arguments of an IPC message.
+v8::Local<v8::Value> DeserializeV8ArrayPrefix(v8::Isolate* isolate,
+                                              const blink::CloneableMessage& in,
+                                              size_t count);
+
 }  // namespace electron
 
 #endif  // ELECTRON_SHELL_COMMON_V8_VALUE_SERIALIZER_H_
@@ -17,6 +17,7 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/promise.h"
+#include "shell/common/ipc_channel_interner.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_value_serializer.h"
@@ -97,7 +98,8 @@ class IPCRenderer final : public gin::Wrappable<IPCRenderer>,
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return;
     }
-    electron_ipc_remote_->Message(internal, channel, std::move(message));
+    electron_ipc_remote_->Message(internal, channels_.Intern(channel),
+                                  std::move(message));
   }
 
   v8::Local<v8::Promise> Invoke(v8::Isolate* isolate,
@@ -117,7 +119,7 @@ class IPCRenderer final : public gin::Wrappable<IPCRenderer>,
     auto handle = p.GetHandle();
 
     electron_ipc_remote_->Invoke(
-        internal, channel, std::move(message),
+        internal, channels_.Intern(channel), std::move(message),
         base::BindOnce(
             [](gin_helper::Promise<blink::CloneableMessage> p,
                blink::CloneableMessage result) { p.Resolve(result); },
@@ -197,13 +199,15 @@ class IPCRenderer final : public gin::Wrappable<IPCRenderer>,
     }
 
     blink::CloneableMessage result;
-    electron_ipc_remote_->MessageSync(internal, channel, std::move(message),
-                                      &result);
+    electron_ipc_remote_->MessageSync(internal, channels_.Intern(channel),
+                                      std::move(message), &result);
     return electron::DeserializeV8Value(isolate, result);
   }
 
   v8::Global<v8::Context> weak_context_;
   mojo::AssociatedRemote<electron::mojom::ElectronApiIPC> electron_ipc_remote_;
+  // Channels sent over |electron_ipc_remote_|.
+  electron::IPCChannelInterner channels_;
 };
 
 gin::WrapperInfo IPCRenderer::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -4,12 +4,17 @@
 
 #include "shell/renderer/browser_exposed_renderer_interfaces.h"
 
+#include <memory>
 #include <utility>
 
 #include "base/functional/bind.h"
 #include "base/task/sequenced_task_runner.h"
 #include "electron/buildflags/buildflags.h"
 #include "mojo/public/cpp/bindings/binder_map.h"
+#include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "shell/common/api/api.mojom.h"
+#include "shell/common/resource_cache.h"
+#include "shell/common/thread_restrictions.h"
 #include "shell/renderer/renderer_client_base.h"
 
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
@@ -17,6 +22,30 @@
 #endif
 
 namespace {
+
+class ResourceCacheImpl : public electron::mojom::ElectronResourceCache {
+ public:
+  ResourceCacheImpl() = default;
+
+  // disable copy
+  ResourceCacheImpl(const ResourceCacheImpl&) = delete;
+  ResourceCacheImpl& operator=(const ResourceCacheImpl&) = delete;
+
+  // electron::mojom::ElectronResourceCache:
+  void Attach(base::File file) override {
+    // The browser process has verified the checksum of the file already.
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    electron::ResourceCache::Get()->Attach(std::move(file),
+                                           /*verify_checksum=*/false);
+  }
+};
+
+void BindResourceCache(
+    mojo::PendingReceiver<electron::mojom::ElectronResourceCache> receiver) {
+  mojo::MakeSelfOwnedReceiver(std::make_unique<ResourceCacheImpl>(),
+                              std::move(receiver));
+}
+
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
 void BindSpellChecker(
     electron::RendererClientBase* client,
@@ -31,6 +60,9 @@ void BindSpellChecker(
 void ExposeElectronRendererInterfacesToBrowser(
     electron::RendererClientBase* client,
     mojo::BinderMap* binders) {
+  binders->Add<electron::mojom::ElectronResourceCache>(
+      base::BindRepeating(&BindResourceCache),
+      base::SequencedTaskRunner::GetCurrentDefault());
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
   binders->Add<spellcheck::mojom::SpellChecker>(
       base::BindRepeating(&BindSpellChecker, client),
@@ -9,8 +9,13 @@
 #include <utility>
 #include <vector>
 
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/memory/shared_memory_mapping.h"
 #include "base/trace_event/trace_event.h"
 #include "gin/data_object_builder.h"
+#include "gin/function_template.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "mojo/public/cpp/system/platform_handle.h"
 #include "shell/common/electron_constants.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -22,6 +27,7 @@
 #include "shell/common/v8_value_serializer.h"
 #include "shell/renderer/electron_render_frame_observer.h"
 #include "shell/renderer/renderer_client_base.h"
+#include "third_party/blink/public/common/messaging/message_port_channel.h"
 #include "third_party/blink/public/mojom/frame/user_activation_notification_type.mojom-shared.h"
 #include "third_party/blink/public/platform/scheduler/web_agent_group_scheduler.h"
 #include "third_party/blink/public/web/blink.h"
@@ -34,6 +40,11 @@ namespace {
 
 const char kIpcKey[] = "ipcNative";
 
+// Must match IPC_MESSAGES.RENDERER_RECEIVE_CHANNEL and
+// IPC_MESSAGES.RENDERER_REVOKE_CHANNEL in ipc-messages.ts.
+const char kReceiveChannel[] = "RENDERER_RECEIVE_CHANNEL";
+const char kRevokeChannel[] = "RENDERER_REVOKE_CHANNEL";
+
 // Gets the private object under kIpcKey
 v8::Local<v8::Object> GetIpcObject(v8::Local<v8::Context> context) {
   auto* isolate = context->GetIsolate();
@@ -49,50 +60,57 @@ v8::Local<v8::Object> GetIpcObject(v8::Local<v8::Context> context) {
   return value->ToObject(context).ToLocalChecked();
 }
 
-void InvokeIpcCallback(v8::Local<v8::Context> context,
-                       const std::string& callback_name,
-                       std::vector<v8::Local<v8::Value>> args) {
-  TRACE_EVENT0("devtools.timeline", "FunctionCall");
-  auto* isolate = context->GetIsolate();
+// Returns the string form of |exception|, which the main process rejects
+// with.
+std::string GetExceptionMessage(v8::Local<v8::Context> context,
+                                v8::Local<v8::Value> exception) {
+  v8::Local<v8::String> message;
+  if (exception.IsEmpty() || !exception->ToString(context).ToLocal(&message))
+    return "Script failed to execute";
+  return gin::V8ToString(context->GetIsolate(), message);
+}
 
-  auto ipcNative = GetIpcObject(context);
-  if (ipcNative.IsEmpty())
+void ReplyWithValue(mojom::ElectronRenderer::ExecuteScriptCallback callback,
+                    v8::Local<v8::Context> context,
+                    v8::Local<v8::Value> value) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::TryCatch try_catch(isolate);
+  blink::CloneableMessage message;
+  if (!SerializeV8Value(isolate, value, &message)) {
+    std::move(callback).Run(mojom::ScriptResult::NewError(
+        GetExceptionMessage(context, try_catch.Exception())));
     return;
-
-  // Only set up the node::CallbackScope if there's a node environment.
-  // Sandboxed renderers don't have a node environment.
-  std::unique_ptr<node::CallbackScope> callback_scope;
-  if (node::Environment::GetCurrent(context)) {
-    callback_scope = std::make_unique<node::CallbackScope>(
-        isolate, ipcNative, node::async_context{0, 0});
   }
-
-  auto callback_key = gin::ConvertToV8(isolate, callback_name)
-                          ->ToString(context)
-                          .ToLocalChecked();
-  auto callback_value = ipcNative->Get(context, callback_key).ToLocalChecked();
-  DCHECK(callback_value->IsFunction());  // set by init.ts
-  auto callback = callback_value.As<v8::Function>();
-  std::ignore = callback->Call(context, ipcNative, args.size(), args.data());
+  std::move(callback).Run(mojom::ScriptResult::NewValue(std::move(message)));
 }
 
-void EmitIPCEvent(v8::Local<v8::Context> context,
-                  bool internal,
-                  const std::string& channel,
-                  std::vector<v8::Local<v8::Value>> ports,
-                  v8::Local<v8::Value> args) {
-  auto* isolate = context->GetIsolate();
-
-  v8::HandleScope handle_scope(isolate);
-  v8::Context::Scope context_scope(context);
-  v8::MicrotasksScope script_scope(isolate, context->GetMicrotaskQueue(),
-                                   v8::MicrotasksScope::kRunMicrotasks);
+void OnScriptSettled(bool fulfilled,
+                     mojom::ElectronRenderer::ExecuteScriptCallback& callback,
+                     gin::Arguments* args) {
+  if (!callback)
+    return;
 
-  std::vector<v8::Local<v8::Value>> argv = {
-      gin::ConvertToV8(isolate, internal), gin::ConvertToV8(isolate, channel),
-      gin::ConvertToV8(isolate, ports), args};
+  v8::Local<v8::Context> context = args->isolate()->GetCurrentContext();
+  v8::Local<v8::Value> value = v8::Undefined(args->isolate());
+  args->GetNext(&value);
+  if (fulfilled) {
+    ReplyWithValue(std::move(callback), context, value);
+  } else {
+    std::move(callback).Run(
+        mojom::ScriptResult::NewError(GetExceptionMessage(context, value)));
+  }
+}
 
-  InvokeIpcCallback(context, "onMessage", argv);
+v8::Local<v8::Function> CreateSettledCallback(
+    v8::Local<v8::Context> context,
+    bool fulfilled,
+    mojom::ElectronRenderer::ExecuteScriptCallback callback) {
+  return gin::CreateFunctionTemplate(
+             context->GetIsolate(),
+             base::BindRepeating(&OnScriptSettled, fulfilled,
+                                 base::OwnedRef(std::move(callback))))
+      ->GetFunction(context)
+      .ToLocalChecked();
 }
 
 }  // namespace
@@ -114,6 +132,7 @@ void ElectronApiServiceImpl::BindTo(
     if (receiver_.is_bound())
       receiver_.reset();
 
+    channels_.Reset();
     receiver_.Bind(std::move(receiver));
     receiver_.set_disconnect_handler(base::BindOnce(
         &ElectronApiServiceImpl::OnConnectionError, GetWeakPtr()));
@@ -135,6 +154,7 @@ void ElectronApiServiceImpl::DidCreateDocumentElement() {
     if (receiver_.is_bound())
       receiver_.reset();
 
+    channels_.Reset();
     receiver_.Bind(std::move(pending_receiver_));
     receiver_.set_disconnect_handler(base::BindOnce(
         &ElectronApiServiceImpl::OnConnectionError, GetWeakPtr()));
@@ -150,9 +170,111 @@ void ElectronApiServiceImpl::OnConnectionError() {
     receiver_.reset();
 }
 
+bool ElectronApiServiceImpl::GetIpcCallback(
+    v8::Local<v8::Context> context,
+    v8::Local<v8::Object>* ipc_native,
+    v8::Local<v8::Function>* on_message) {
+  auto* isolate = context->GetIsolate();
+  if (ipc_context_.IsEmpty() || ipc_native_.IsEmpty() ||
+      ipc_on_message_.IsEmpty() || ipc_context_.Get(isolate) != context) {
+    ipc_native_.Reset();
+    ipc_on_message_.Reset();
+
+    auto ipc_object = GetIpcObject(context);
+    if (ipc_object.IsEmpty())
+      return false;
+
+    auto callback_key = gin::StringToSymbol(isolate, "onMessage");
+    auto callback_value =
+        ipc_object->Get(context, callback_key).ToLocalChecked();
+    DCHECK(callback_value->IsFunction());  // set by init.ts
+    if (!callback_value->IsFunction())
+      return false;
+
+    ipc_context_.Reset(isolate, context);
+    ipc_context_.SetWeak();
+    ipc_native_.Reset(isolate, ipc_object);
+    ipc_native_.SetWeak();
+    ipc_on_message_.Reset(isolate, callback_value.As<v8::Function>());
+    ipc_on_message_.SetWeak();
+  }
+
+  *ipc_native = ipc_native_.Get(isolate);
+  *on_message = ipc_on_message_.Get(isolate);
+  return true;
+}
+
+void ElectronApiServiceImpl::EmitIPCEvent(
+    v8::Local<v8::Context> context,
+    bool internal,
+    const std::string& channel,
+    std::vector<v8::Local<v8::Value>> ports,
+    v8::Local<v8::Value> args) {
+  auto* isolate = context->GetIsolate();
+
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::MicrotasksScope script_scope(isolate, context->GetMicrotaskQueue(),
+                                   v8::MicrotasksScope::kRunMicrotasks);
+
+  TRACE_EVENT0("devtools.timeline", "FunctionCall");
+
+  v8::Local<v8::Object> ipc_native;
+  v8::Local<v8::Function> on_message;
+  if (!GetIpcCallback(context, &ipc_native, &on_message))
+    return;
+
+  // Only set up the node::CallbackScope if there's a node environment.
+  // Sandboxed renderers don't have a node environment.
+  std::unique_ptr<node::CallbackScope> callback_scope;
+  if (node::Environment::GetCurrent(context)) {
+    callback_scope = std::make_unique<node::CallbackScope>(
+        isolate, ipc_native, node::async_context{0, 0});
+  }
+
+  std::vector<v8::Local<v8::Value>> argv = {
+      gin::ConvertToV8(isolate, internal), gin::StringToV8(isolate, channel),
+      gin::ConvertToV8(isolate, ports), args};
+  std::ignore = on_message->Call(context, ipc_native, argv.size(), argv.data());
+}
+
 void ElectronApiServiceImpl::Message(bool internal,
-                                     const std::string& channel,
+                                     mojom::IPCChannelPtr channel,
                                      blink::CloneableMessage arguments) {
+  const std::string* name = channels_.Resolve(channel);
+  if (!name) {
+    receiver_.ReportBadMessage("Invalid IPC channel");
+    return;
+  }
+
+  DispatchMessage(internal, *name, arguments);
+}
+
+void ElectronApiServiceImpl::MessageShared(
+    bool internal,
+    mojom::IPCChannelPtr channel,
+    base::ReadOnlySharedMemoryRegion arguments) {
+  const std::string* name = channels_.Resolve(channel);
+  if (!name) {
+    receiver_.ReportBadMessage("Invalid IPC channel");
+    return;
+  }
+
+  base::ReadOnlySharedMemoryMapping mapping = arguments.Map();
+  if (!mapping.IsValid()) {
+    LOG(ERROR) << "Failed to map the arguments of an IPC message";
+    return;
+  }
+
+  blink::CloneableMessage message;
+  message.encoded_message = mapping.GetMemoryAsSpan<uint8_t>();
+  DispatchMessage(internal, *name, message);
+}
+
+void ElectronApiServiceImpl::DispatchMessage(
+    bool internal,
+    const std::string& channel,
+    const blink::CloneableMessage& arguments) {
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
   if (!frame)
     return;
@@ -195,6 +317,49 @@ void ElectronApiServiceImpl::ReceivePostMessage(
   EmitIPCEvent(context, false, channel, ports, gin::ConvertToV8(isolate, args));
 }
 
+void ElectronApiServiceImpl::ReceiveChannel(
+    const std::string& channel,
+    uint64_t grant_id,
+    blink::MessagePortDescriptor port) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame)
+    return;
+
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Context> context = renderer_client_->GetContext(frame, isolate);
+  v8::Context::Scope context_scope(context);
+
+  std::vector<v8::Local<v8::Value>> ports = {
+      blink::WebMessagePortConverter::EntangleAndInjectMessagePortChannel(
+          context, blink::MessagePortChannel(std::move(port)))};
+  std::vector<v8::Local<v8::Value>> args = {
+      gin::StringToV8(isolate, channel), gin::ConvertToV8(isolate, grant_id)};
+
+  EmitIPCEvent(context, true, kReceiveChannel, ports,
+               gin::ConvertToV8(isolate, args));
+}
+
+void ElectronApiServiceImpl::RevokeChannel(const std::string& channel,
+                                           uint64_t grant_id) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame)
+    return;
+
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Context> context = renderer_client_->GetContext(frame, isolate);
+  v8::Context::Scope context_scope(context);
+
+  std::vector<v8::Local<v8::Value>> args = {
+      gin::StringToV8(isolate, channel), gin::ConvertToV8(isolate, grant_id)};
+
+  EmitIPCEvent(context, true, kRevokeChannel, {},
+               gin::ConvertToV8(isolate, args));
+}
+
 void ElectronApiServiceImpl::TakeHeapSnapshot(
     mojo::ScopedHandle file,
     TakeHeapSnapshotCallback callback) {
@@ -219,4 +384,92 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
   std::move(callback).Run(success);
 }
 
+void ElectronApiServiceImpl::ExecuteScript(
+    uint32_t script_id,
+    const std::optional<std::u16string>& source,
+    bool user_gesture,
+    ExecuteScriptCallback callback) {
+  if (!source && (script_id == 0 || !scripts_.contains(script_id))) {
+    receiver_.ReportBadMessage("Missing script source");
+    return;
+  }
+
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(
+        mojom::ScriptResult::NewError("Render frame is not available"));
+    return;
+  }
+
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Context> context = frame->MainWorldScriptContext();
+  v8::Context::Scope context_scope(context);
+  v8::MicrotasksScope microtasks_scope(isolate, context->GetMicrotaskQueue(),
+                                       v8::MicrotasksScope::kRunMicrotasks);
+  v8::TryCatch try_catch(isolate);
+
+  v8::Local<v8::UnboundScript> script;
+  if (script_id == 0) {
+    v8::ScriptCompiler::Source script_source(gin::StringToV8(isolate, *source));
+    if (!v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+             .ToLocal(&script)) {
+      std::move(callback).Run(mojom::ScriptResult::NewError(
+          GetExceptionMessage(context, try_catch.Exception())));
+      return;
+    }
+  } else {
+    auto [compiled, inserted] = scripts_.try_emplace(script_id);
+    if (inserted) {
+      v8::ScriptCompiler::Source script_source(
+          gin::StringToV8(isolate, *source));
+      if (v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+              .ToLocal(&script)) {
+        compiled->second.script.Reset(isolate, script);
+      } else {
+        compiled->second.error =
+            GetExceptionMessage(context, try_catch.Exception());
+      }
+    }
+    if (compiled->second.script.IsEmpty()) {
+      std::move(callback).Run(
+          mojom::ScriptResult::NewError(compiled->second.error));
+      return;
+    }
+    script = compiled->second.script.Get(isolate);
+  }
+
+  if (user_gesture) {
+    frame->NotifyUserActivation(
+        blink::mojom::UserActivationNotificationType::kInteraction);
+  }
+
+  v8::Local<v8::Value> result;
+  if (!script->BindToCurrentContext()->Run(context).ToLocal(&result)) {
+    std::move(callback).Run(mojom::ScriptResult::NewError(
+        GetExceptionMessage(context, try_catch.Exception())));
+    return;
+  }
+
+  if (!result->IsPromise()) {
+    ReplyWithValue(std::move(callback), context, result);
+    return;
+  }
+
+  // A promise that is collected without settling still gets a reply.
+  auto [on_fulfilled, on_rejected] =
+      base::SplitOnceCallback(mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+          std::move(callback),
+          mojom::ScriptResult::NewError(
+              "The promise returned by the script was never settled")));
+  std::ignore = result.As<v8::Promise>()->Then(
+      context, CreateSettledCallback(context, true, std::move(on_fulfilled)),
+      CreateSettledCallback(context, false, std::move(on_rejected)));
+}
+
+void ElectronApiServiceImpl::ForgetScript(uint32_t script_id) {
+  scripts_.erase(script_id);
+}
+
 }  // namespace electron
@@ -5,14 +5,22 @@
 #ifndef ELECTRON_SHELL_RENDERER_ELECTRON_API_SERVICE_IMPL_H_
 #define ELECTRON_SHELL_RENDERER_ELECTRON_API_SERVICE_IMPL_H_
 
+#include <map>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "electron/shell/common/api/api.mojom.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/receiver.h"
+#include "shell/common/ipc_channel_interner.h"
+#include "third_party/blink/public/common/messaging/message_port_descriptor.h"
+#include "v8/include/v8-forward.h"
+#include "v8/include/v8-persistent-handle.h"
 
 namespace electron {
 
@@ -33,12 +41,24 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
 
   // mojom::ElectronRenderer
   void Message(bool internal,
-               const std::string& channel,
+               mojom::IPCChannelPtr channel,
                blink::CloneableMessage arguments) override;
+  void MessageShared(bool internal,
+                     mojom::IPCChannelPtr channel,
+                     base::ReadOnlySharedMemoryRegion arguments) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
+  void ReceiveChannel(const std::string& channel,
+                      uint64_t grant_id,
+                      blink::MessagePortDescriptor port) override;
+  void RevokeChannel(const std::string& channel, uint64_t grant_id) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
                         TakeHeapSnapshotCallback callback) override;
+  void ExecuteScript(uint32_t script_id,
+                     const std::optional<std::u16string>& source,
+                     bool user_gesture,
+                     ExecuteScriptCallback callback) override;
+  void ForgetScript(uint32_t script_id) override;
   void ProcessPendingMessages();
 
   base::WeakPtr<ElectronApiServiceImpl> GetWeakPtr() {
@@ -56,12 +76,47 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
 
   void OnConnectionError();
 
+  void DispatchMessage(bool internal,
+                       const std::string& channel,
+                       const blink::CloneableMessage& arguments);
+
+  // Gets ipcNative and its onMessage callback for |context|, which are
+  // looked up once per context rather than once per message.
+  bool GetIpcCallback(v8::Local<v8::Context> context,
+                      v8::Local<v8::Object>* ipc_native,
+                      v8::Local<v8::Function>* on_message);
+  void EmitIPCEvent(v8::Local<v8::Context> context,
+                    bool internal,
+                    const std::string& channel,
+                    std::vector<v8::Local<v8::Value>> ports,
+                    v8::Local<v8::Value> args);
+
   // Whether the DOM document element has been created.
   bool document_created_ = false;
   service_manager::BinderRegistry registry_;
 
   mojo::PendingReceiver<mojom::ElectronRenderer> pending_receiver_;
   mojo::Receiver<mojom::ElectronRenderer> receiver_{this};
+  // Channels received over |receiver_|.
+  IPCChannelResolver channels_;
+
+  struct CompiledScript {
+    v8::Global<v8::UnboundScript> script;
+    // The exception thrown by the compiler, if |script| is empty.
+    std::string error;
+  };
+
+  // Scripts registered in the main process, which are compiled once for the
+  // lifetime of the frame or until they are unregistered. Script IDs are
+  // unique per main process, so they are kept when |receiver_| is bound
+  // again.
+  std::map<uint32_t, CompiledScript> scripts_;
+
+  // The context the ipcNative handles below belong to. All three are held
+  // weakly so that the cache does not keep a navigated-away context alive.
+  v8::Global<v8::Context> ipc_context_;
+  v8::Global<v8::Object> ipc_native_;
+  v8::Global<v8::Function> ipc_on_message_;
 
   raw_ptr<RendererClientBase> renderer_client_;
   base::WeakPtrFactory<ElectronApiServiceImpl> weak_factory_{this};
@@ -8,6 +8,7 @@
 
 #include "base/command_line.h"
 #include "base/no_destructor.h"
+#include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "services/network/public/cpp/wrapper_shared_url_loader_factory.h"
 #include "services/network/public/mojom/host_resolver.mojom.h"
@@ -19,6 +20,7 @@
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
 #include "shell/services/node/parent_port.h"
+#include "v8/include/v8-initialization.h"
 
 namespace electron {
 
@@ -86,6 +88,13 @@ void NodeService::Initialize(node::mojom::NodeServiceParamsPtr params) {
       mojo::Remote(std::move(params->host_resolver)),
       params->use_network_observer_from_url_loader_factory);
 
+  // Heap limits are read when the isolate is created.
+  if (params->max_old_generation_size_mb) {
+    const std::string flag = base::StringPrintf(
+        "--max-old-space-size=%u", params->max_old_generation_size_mb);
+    v8::V8::SetFlagsFromString(flag.c_str(), flag.size());
+  }
+
   js_env_ = std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
 
   v8::HandleScope scope(js_env_->isolate());
@@ -145,4 +154,27 @@ void NodeService::Initialize(node::mojom::NodeServiceParamsPtr params) {
   node_bindings_->StartPolling();
 }
 
+void NodeService::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  if (!node_env_ || node_env_stopped_)
+    return;
+
+  base::MemoryPressureListener::NotifyMemoryPressure(level);
+
+  v8::MemoryPressureLevel v8_level = v8::MemoryPressureLevel::kNone;
+  switch (level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      v8_level = v8::MemoryPressureLevel::kModerate;
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      v8_level = v8::MemoryPressureLevel::kCritical;
+      break;
+  }
+  js_env_->isolate()->MemoryPressureNotification(v8_level);
+
+  ParentPort::GetInstance()->EmitMemoryPressure(level);
+}
+
 }  // namespace electron
@@ -7,6 +7,7 @@
 
 #include <memory>
 
+#include "base/memory/memory_pressure_listener.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/receiver.h"
@@ -62,6 +63,8 @@ class NodeService : public node::mojom::NodeService {
 
   // mojom::NodeService implementation:
   void Initialize(node::mojom::NodeServiceParamsPtr params) override;
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level) override;
 
  private:
   // This needs to be initialized first so that it can be destroyed last
@@ -12,6 +12,7 @@
 #include "gin/object_template_builder.h"
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_converters/base_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_includes.h"
@@ -42,6 +43,18 @@ void ParentPort::Initialize(blink::MessagePortDescriptor port) {
       base::BindOnce(&ParentPort::Close, base::Unretained(this)));
 }
 
+void ParentPort::EmitMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Object> self;
+  if (!GetWrapper(isolate).ToLocal(&self))
+    return;
+
+  auto event = gin::DataObjectBuilder(isolate).Set("level", level).Build();
+  gin_helper::EmitEvent(isolate, self, "memory-pressure", event);
+}
+
 void ParentPort::PostMessage(v8::Local<v8::Value> message_value) {
   if (!connector_closed_ && connector_ && connector_->is_valid()) {
     v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
@@ -7,6 +7,7 @@
 
 #include <memory>
 
+#include "base/memory/memory_pressure_listener.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/connector.h"
 #include "mojo/public/cpp/bindings/message.h"
@@ -43,6 +44,10 @@ class ParentPort final : public gin::Wrappable<ParentPort>,
   ~ParentPort() override;
   void Initialize(blink::MessagePortDescriptor port);
 
+  // Emits 'memory-pressure' with the level the browser signalled.
+  void EmitMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
   gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
@@ -1477,6 +1477,95 @@ describe('app module', () => {
     });
   });
 
+  describe('startAppMetricsSampling() API', () => {
+    afterEach(() => {
+      app.stopAppMetricsSampling();
+    });
+
+    it('throws for an invalid interval', () => {
+      expect(() => {
+        app.startAppMetricsSampling({ interval: 0 });
+      }).to.throw('interval must be a positive integer');
+    });
+
+    it('emits samples that include the browser process', async () => {
+      app.startAppMetricsSampling({ interval: 50 });
+      const [, sample] = await once(app, 'app-metrics-sample');
+      expect(sample.processes).to.be.an.instanceOf(Float64Array);
+      expect(sample.exited).to.be.an.instanceOf(Int32Array);
+      expect(sample.processes.length % 4).to.equal(0);
+      const pids = sample.processes.filter((_: number, i: number) => i % 4 === 0);
+      expect(Array.from(pids)).to.include(process.pid);
+    });
+
+    it('does not emit samples of a replaced sampler', async () => {
+      app.startAppMetricsSampling({ interval: 1 });
+      await once(app, 'app-metrics-sample');
+      let samples = 0;
+      const onSample = () => { samples++; };
+      app.on('app-metrics-sample', onSample);
+      try {
+        app.startAppMetricsSampling({ interval: 60000 });
+        await new Promise(resolve => setTimeout(resolve, 500));
+        expect(samples).to.equal(0);
+      } finally {
+        app.off('app-metrics-sample', onSample);
+      }
+    });
+
+    it('reports processes that went away', async () => {
+      const seen = new Set<number>();
+      const gone = new Set<number>();
+      const onSample = (event: Electron.Event, sample: { processes: Float64Array, exited: Int32Array }) => {
+        for (let i = 0; i < sample.processes.length; i += 4) seen.add(sample.processes[i]);
+        for (const pid of sample.exited) gone.add(pid);
+      };
+      app.on('app-metrics-sample', onSample);
+      try {
+        app.startAppMetricsSampling({ interval: 50 });
+        const child = utilityProcess.fork(path.join(fixturesPath, 'api', 'utility-process', 'endless.js'));
+        await once(child, 'spawn');
+        const pid = child.pid!;
+        await waitUntil(() => seen.has(pid));
+        child.kill();
+        await waitUntil(() => gone.has(pid));
+      } finally {
+        app.off('app-metrics-sample', onSample);
+      }
+    });
+  });
+
+  describe('getMainThreadTaskStats() API', () => {
+    it('throws for invalid options', () => {
+      expect(() => {
+        app.getMainThreadTaskStats({ duration: 61 });
+      }).to.throw('duration must be an integer between 1 and 60');
+      expect(() => {
+        app.getMainThreadTaskStats({ count: 0 });
+      }).to.throw('count must be a positive integer');
+    });
+
+    it('attributes time spent in Node.js callbacks to a tag', async () => {
+      await new Promise<void>(resolve => setTimeout(() => {
+        const start = Date.now();
+        while (Date.now() - start < 50);
+        resolve();
+      }));
+      await new Promise(resolve => setTimeout(resolve));
+      const stats = app.getMainThreadTaskStats({ duration: 10 });
+      expect(stats.length).to.be.at.most(20);
+      const node = stats.find(entry => entry.name === 'node:uvRunOnce');
+      expect(node).to.not.be.undefined();
+      expect(node!.location).to.be.undefined();
+      expect(node!.maxTime).to.be.at.least(50);
+      expect(node!.totalTime).to.be.at.least(node!.maxTime);
+    });
+
+    it('limits the number of entries', () => {
+      expect(app.getMainThreadTaskStats({ count: 1 })).to.have.lengthOf(1);
+    });
+  });
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus();
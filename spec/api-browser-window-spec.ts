@@ -3317,6 +3317,15 @@ describe('BrowserWindow module', () => {
     afterEach(() => { ipcMain.removeAllListeners('answer'); });
     afterEach(closeAllWindows);
 
+    it('reads a boolean preference that is explicitly undefined as false', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: { nodeIntegration: true, contextIsolation: undefined, sandbox: undefined }
+      });
+      await w.loadURL('about:blank');
+      expect(await w.webContents.executeJavaScript('typeof require')).to.equal('function');
+    });
+
     describe('"preload" option', () => {
       const doesNotLeakSpec = (name: string, webPrefs: { nodeIntegration: boolean, sandbox: boolean, contextIsolation: boolean }) => {
         it(name, async () => {
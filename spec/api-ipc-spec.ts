@@ -2,7 +2,7 @@ import { EventEmitter, once } from 'node:events';
 import { expect } from 'chai';
 import { BrowserWindow, ipcMain, IpcMainInvokeEvent, MessageChannelMain, WebContents } from 'electron/main';
 import { closeAllWindows } from './lib/window-helpers';
-import { defer, listen } from './lib/spec-helpers';
+import { defer, listen, waitUntil } from './lib/spec-helpers';
 import * as path from 'node:path';
 import * as http from 'node:http';
 
@@ -200,6 +200,66 @@ describe('ipc module', () => {
     });
   });
 
+  describe('channels', () => {
+    let w: BrowserWindow;
+
+    before(async () => {
+      w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+    });
+    after(async () => {
+      w.destroy();
+    });
+
+    // More distinct channels than are interned on a connection, so that both
+    // interned and plain channel names are exercised.
+    const channelCount = 5000;
+
+    it('delivers messages from the renderer on many channels', async () => {
+      const received: string[] = [];
+      const listener = (e: Electron.IpcMainEvent, channel: string) => { received.push(channel); };
+      for (let i = 0; i < channelCount; i++) ipcMain.on(`channel-${i}`, listener);
+      const done = new Promise<void>(resolve => ipcMain.once('done', () => { resolve(); }));
+      function rendererSend (count: number) {
+        const { ipcRenderer } = require('electron');
+        for (let i = 0; i < count; i++) {
+          ipcRenderer.send(`channel-${i}`, `channel-${i}`);
+          ipcRenderer.send('channel-0', 'channel-0');
+        }
+        ipcRenderer.send('done');
+      }
+      try {
+        w.webContents.executeJavaScript(`(${rendererSend})(${channelCount})`);
+        await done;
+      } finally {
+        for (let i = 0; i < channelCount; i++) ipcMain.removeListener(`channel-${i}`, listener);
+      }
+      const expected = Array.from({ length: channelCount }, (_, i) => [`channel-${i}`, 'channel-0']).flat();
+      expect(received).to.deep.equal(expected);
+    });
+
+    it('delivers messages to the renderer on many channels', async () => {
+      function rendererListen (count: number) {
+        const { ipcRenderer } = require('electron');
+        const received: string[] = [];
+        for (let i = 0; i < count; i++) {
+          ipcRenderer.on(`channel-${i}`, (e: any, channel: string) => { received.push(channel); });
+        }
+        ipcRenderer.once('done', () => { ipcRenderer.send('received', received); });
+      }
+      await w.webContents.executeJavaScript(`(${rendererListen})(${channelCount})`);
+      const received = once(ipcMain, 'received');
+      for (let i = 0; i < channelCount; i++) {
+        w.webContents.send(`channel-${i}`, `channel-${i}`);
+        w.webContents.send('channel-0', 'channel-0');
+      }
+      w.webContents.send('done');
+      const [, channels] = await received;
+      const expected = Array.from({ length: channelCount }, (_, i) => [`channel-${i}`, 'channel-0']).flat();
+      expect(channels).to.deep.equal(expected);
+    });
+  });
+
   describe('MessagePort', () => {
     afterEach(closeAllWindows);
 
@@ -528,6 +588,74 @@ describe('ipc module', () => {
         }).to.throw(/contains the source port/);
       });
 
+      describe('shared memory transport', () => {
+        it('delivers messages in order', async () => {
+          const { port1, port2 } = new MessageChannelMain();
+          port1.postMessage('before');
+          port1.enableSharedMemoryTransport({ bufferSize: 4096 });
+          // Enough messages to wrap around and fill the buffer several times.
+          for (let i = 0; i < 1000; i++) port1.postMessage({ i, payload: 'x'.repeat(i % 64) });
+          const received: any[] = [];
+          port2.on('message', (e) => received.push(e.data));
+          port2.start();
+          await waitUntil(() => received.length === 1001);
+          expect(received[0]).to.equal('before');
+          expect(received.slice(1).map(d => d.i)).to.deep.equal([...Array(1000).keys()]);
+        });
+
+        it('throws when transferring ports', () => {
+          const { port1 } = new MessageChannelMain();
+          const { port1: port3 } = new MessageChannelMain();
+          port1.enableSharedMemoryTransport();
+          expect(() => {
+            port1.postMessage(null, [port3]);
+          }).to.throw(/Ports cannot be transferred/);
+        });
+
+        it('throws when a message does not fit in the buffer', () => {
+          const { port1 } = new MessageChannelMain();
+          port1.enableSharedMemoryTransport({ bufferSize: 4096 });
+          expect(() => {
+            port1.postMessage('x'.repeat(8192));
+          }).to.throw(/does not fit/);
+        });
+
+        it('prevents the port from being transferred', () => {
+          const { port1 } = new MessageChannelMain();
+          const { port1: port3 } = new MessageChannelMain();
+          port3.enableSharedMemoryTransport();
+          expect(() => {
+            port1.postMessage(null, [port3]);
+          }).to.throw(/shared memory transport/);
+        });
+
+        it('delivers pending messages before close', async () => {
+          const { port1, port2 } = new MessageChannelMain();
+          port1.enableSharedMemoryTransport();
+          port1.postMessage('hello');
+          port1.close();
+          const received: any[] = [];
+          port2.on('message', (e) => received.push(e.data));
+          port2.start();
+          await once(port2, 'close');
+          expect(received).to.deep.equal(['hello']);
+        });
+
+        it('delivers messages that did not fit in the buffer before close', async () => {
+          const { port1, port2 } = new MessageChannelMain();
+          port1.enableSharedMemoryTransport({ bufferSize: 4096 });
+          // The peer is not reading yet, so most of these are still queued
+          // when the port is closed.
+          for (let i = 0; i < 200; i++) port1.postMessage({ i, payload: 'x'.repeat(100) });
+          port1.close();
+          const received: any[] = [];
+          port2.on('message', (e) => received.push(e.data.i));
+          port2.start();
+          await once(port2, 'close');
+          expect(received).to.deep.equal([...Array(200).keys()]);
+        });
+      });
+
       describe('GC behavior', () => {
         it('is not collected while it could still receive messages', async () => {
           let trigger: Function;
@@ -645,6 +773,52 @@ describe('ipc module', () => {
     generateTests('WebFrameMain.postMessage', contents => contents.mainFrame.postMessage.bind(contents.mainFrame));
   });
 
+  describe('grantChannel', () => {
+    afterEach(closeAllWindows);
+
+    it('connects two WebContents directly', async () => {
+      const w1 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      const w2 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await Promise.all([w1.loadURL('about:blank'), w2.loadURL('about:blank')]);
+      const received = w2.webContents.executeJavaScript(`(async () => {
+        const port = await require('electron').ipcRenderer.getChannel('test');
+        return new Promise(resolve => { port.onmessage = (e) => resolve(e.data); });
+      })()`);
+      w1.webContents.grantChannel('test', w2.webContents);
+      await w1.webContents.executeJavaScript(`(async () => {
+        const port = await require('electron').ipcRenderer.getChannel('test');
+        port.postMessage('hello');
+      })()`);
+      expect(await received).to.equal('hello');
+    });
+
+    it('drops a granted end that was never asked for once the peer goes away', async () => {
+      const w1 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      const w2 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      const w3 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await Promise.all([w1.loadURL('about:blank'), w2.loadURL('about:blank'), w3.loadURL('about:blank')]);
+      w1.webContents.grantChannel('test', w2.webContents);
+      w2.destroy();
+      const received = w3.webContents.executeJavaScript(`(async () => {
+        const port = await require('electron').ipcRenderer.getChannel('test');
+        return new Promise(resolve => { port.onmessage = (e) => resolve(e.data); });
+      })()`);
+      w1.webContents.grantChannel('test', w3.webContents);
+      await w1.webContents.executeJavaScript(`(async () => {
+        const port = await require('electron').ipcRenderer.getChannel('test');
+        port.postMessage('hello');
+      })()`);
+      expect(await received).to.equal('hello');
+    });
+
+    it('throws when the peer is invalid', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.mainFrame.grantChannel('test', {} as any);
+      }).to.throw(/peer must be a WebFrameMain/);
+    });
+  });
+
   describe('WebContents.ipc', () => {
     afterEach(closeAllWindows);
 
@@ -682,6 +856,59 @@ describe('ipc module', () => {
       expect(result).to.equal(42 * 2);
     });
 
+    describe('deferDeserialization', () => {
+      it('delivers a SerializedMessage for deferred channels', async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        w.loadURL('about:blank');
+        w.webContents.ipc.deferDeserialization('test');
+        w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'test\', { type: \'header\' }, \'x\'.repeat(1024))');
+        const [, message] = await once(w.webContents.ipc, 'test');
+        expect(message.byteLength).to.be.greaterThan(1024);
+        expect(message.peek(1)).to.deep.equal([{ type: 'header' }]);
+        expect(message.deserialize()).to.deep.equal([{ type: 'header' }, 'x'.repeat(1024)]);
+      });
+
+      it('peeks arguments that refer to the same object', async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        w.loadURL('about:blank');
+        w.webContents.ipc.deferDeserialization('test');
+        w.webContents.executeJavaScript('const a = { type: \'header\' }; require(\'electron\').ipcRenderer.send(\'test\', a, [\'b\'], a, \'x\'.repeat(1024))');
+        const [, message] = await once(w.webContents.ipc, 'test');
+        const args = message.peek(3);
+        expect(args).to.deep.equal([{ type: 'header' }, ['b'], { type: 'header' }]);
+        expect(args[2]).to.equal(args[0]);
+      });
+
+      it('only defers messages above the threshold', async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        w.loadURL('about:blank');
+        w.webContents.ipc.deferDeserialization('test', { threshold: 1024 });
+        w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'test\', 42)');
+        const [, num] = await once(w.webContents.ipc, 'test');
+        expect(num).to.equal(42);
+      });
+
+      it('can forward a SerializedMessage to another WebContents', async () => {
+        const w1 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        const w2 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        await Promise.all([w1.loadURL('about:blank'), w2.loadURL('about:blank')]);
+        w1.webContents.ipc.deferDeserialization('test');
+        w1.webContents.ipc.on('test', (_event, message) => w2.webContents.send('test', message));
+        const received = w2.webContents.executeJavaScript(`new Promise(resolve => {
+          require('electron').ipcRenderer.once('test', (_event, ...args) => resolve(args));
+        })`);
+        w1.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'test\', 1, [2, 3])');
+        expect(await received).to.deep.equal([1, [2, 3]]);
+      });
+
+      it('throws on an invalid threshold', () => {
+        const w = new BrowserWindow({ show: false });
+        expect(() => {
+          w.webContents.ipc.deferDeserialization('test', { threshold: -1 });
+        }).to.throw(/threshold must be a non-negative integer/);
+      });
+    });
+
     it('cascades to ipcMain', async () => {
       const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
       w.loadURL('about:blank');
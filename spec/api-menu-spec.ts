@@ -1,7 +1,7 @@
 import * as cp from 'node:child_process';
 import * as path from 'node:path';
 import { assert, expect } from 'chai';
-import { BrowserWindow, Menu, MenuItem } from 'electron/main';
+import { BrowserWindow, Menu, MenuItem, nativeImage } from 'electron/main';
 import { sortMenuItems } from '../lib/browser/api/menu-utils';
 import { ifit } from './lib/spec-helpers';
 import { closeWindow } from './lib/window-helpers';
@@ -727,6 +727,114 @@ describe('Menu module', function () {
     });
   });
 
+  describe('Menu.updateMenuItem', () => {
+    it('should update an item in a submenu in place', () => {
+      const menu = Menu.buildFromTemplate([
+        {
+          label: 'Edit',
+          submenu: [
+            { label: 'Cut', id: 'cut' },
+            { label: 'Copy', id: 'copy' }
+          ]
+        }
+      ]);
+      const submenu = menu.items[0].submenu!;
+      const cut = menu.getMenuItemById('cut')!;
+
+      menu.updateMenuItem('cut', { label: 'Cut Text', sublabel: 'Selection', enabled: false });
+      expect(menu.getMenuItemById('cut')).to.equal(cut);
+      expect(cut.label).to.equal('Cut Text');
+      expect(cut.enabled).to.be.false();
+      expect(submenu.getLabelAt(0)).to.equal('Cut Text');
+      expect(submenu.getSublabelAt(0)).to.equal('Selection');
+      expect(submenu.getLabelAt(1)).to.equal('Copy');
+    });
+
+    it('should accept a MenuItem', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: 'Bold', type: 'checkbox' }
+      ]);
+      menu.updateMenuItem(menu.items[0], { checked: true });
+      expect(menu.items[0].checked).to.be.true();
+    });
+
+    it('should uncheck the other radio items of the group', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: 'Small', type: 'radio', id: 'small', checked: true },
+        { label: 'Large', type: 'radio', id: 'large' }
+      ]);
+      menu.updateMenuItem('large', { checked: true });
+      expect(menu.items[0].checked).to.be.false();
+      expect(menu.items[1].checked).to.be.true();
+    });
+
+    it('should not uncheck a radio item', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: 'Small', type: 'radio', id: 'small', checked: true },
+        { label: 'Large', type: 'radio', id: 'large' }
+      ]);
+      expect(() => {
+        menu.updateMenuItem('small', { checked: false });
+      }).to.throw(/A radio item cannot be unchecked/);
+      menu.items[0].checked = false;
+      expect(menu.items[0].checked).to.be.true();
+      expect(menu.items[1].checked).to.be.false();
+    });
+
+    it('should replace the icon of an item more than once', () => {
+      const menu = Menu.buildFromTemplate([{ label: 'Item', id: 'item' }]);
+      const first = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      const second = nativeImage.createFromPath(path.join(fixturesPath, 'assets', '1x1.png'));
+      menu.updateMenuItem('item', { icon: first });
+      expect(menu.items[0].icon).to.equal(first);
+      menu.updateMenuItem('item', { icon: second });
+      expect(menu.items[0].icon).to.equal(second);
+      expect(() => {
+        (menu.items[0] as any).icon = first;
+      }).to.throw(TypeError);
+    });
+
+    it('should tell the observers of the menu which items changed', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: 'Small', type: 'radio', id: 'small', checked: true },
+        { label: 'Large', type: 'radio', id: 'large' },
+        { label: 'Other', id: 'other' }
+      ]);
+      const changed: number[] = [];
+      (menu as any).on('-item-changed', (event: any, index: number) => changed.push(index));
+      menu.updateMenuItem('other', { label: 'Another' });
+      expect(changed).to.deep.equal([2]);
+      changed.length = 0;
+      menu.updateMenuItem('large', { checked: true });
+      expect(changed).to.have.members([0, 1]);
+    });
+
+    it('should throw for an unknown item', () => {
+      const menu = Menu.buildFromTemplate([{ label: 'Item' }]);
+      expect(() => {
+        menu.updateMenuItem('missing', { label: 'Other' });
+      }).to.throw(/No menu item with id 'missing'/);
+      expect(() => {
+        menu.updateMenuItem(new MenuItem({ label: 'Detached' }), { label: 'Other' });
+      }).to.throw(/has not been added to a menu/);
+    });
+
+    it('should throw for an item of another menu', () => {
+      const menu = Menu.buildFromTemplate([{ label: 'Edit', submenu: [{ label: 'Cut' }] }]);
+      const other = Menu.buildFromTemplate([{ label: 'Item' }]);
+      expect(() => {
+        menu.updateMenuItem(other.items[0], { label: 'Other' });
+      }).to.throw(/not in this menu or its submenus/);
+      expect(other.items[0].label).to.equal('Item');
+      const submenu = menu.items[0].submenu!;
+      expect(() => {
+        submenu.updateMenuItem(menu.items[0], { label: 'Other' });
+      }).to.throw(/not in this menu or its submenus/);
+      menu.updateMenuItem(submenu.items[0], { label: 'Cut Text' });
+      expect(submenu.items[0].label).to.equal('Cut Text');
+    });
+  });
+
   describe('Menu.insert', () => {
     it('should throw when attempting to insert at out-of-range indices', () => {
       const menu = Menu.buildFromTemplate([
@@ -1,6 +1,8 @@
 import { expect } from 'chai';
 import { nativeImage } from 'electron/common';
 import { ifdescribe, ifit, itremote, useRemoteContext } from './lib/spec-helpers';
+import * as fs from 'node:fs';
+import * as os from 'node:os';
 import * as path from 'node:path';
 
 describe('nativeImage module', () => {
@@ -303,6 +305,23 @@ describe('nativeImage module', () => {
       expect(image.getSize()).to.deep.equal({ width: 538, height: 190 });
     });
 
+    it('reloads images whose file has changed', () => {
+      const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-native-image-'));
+      try {
+        const imagePath = path.join(dir, 'image.png');
+        fs.copyFileSync(imageLogo.path, imagePath);
+        expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal({ width: 538, height: 190 });
+        expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal({ width: 538, height: 190 });
+
+        fs.copyFileSync(image3x3.path, imagePath);
+        const later = new Date(Date.now() + 60 * 1000);
+        fs.utimesSync(imagePath, later, later);
+        expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal({ width: 3, height: 3 });
+      } finally {
+        fs.rmSync(dir, { recursive: true, force: true });
+      }
+    });
+
     ifit(process.platform === 'darwin')('Gets an NSImage pointer on macOS', function () {
       const imagePath = `${path.join(fixturesPath, 'api')}${path.sep}..${path.sep}${path.join('assets', 'logo.png')}`;
       const image = nativeImage.createFromPath(imagePath);
@@ -380,6 +399,59 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('async variants', () => {
+    it('createFromPathAsync() decodes an image', async () => {
+      const image = await nativeImage.createFromPathAsync(imageLogo.path);
+      expect(image.getSize()).to.deep.equal({ width: imageLogo.width, height: imageLogo.height });
+      expect(image.toBitmap().equals(nativeImage.createFromPath(imageLogo.path).toBitmap())).to.be.true();
+    });
+
+    it('createFromPathAsync() resolves with an empty image for invalid paths', async () => {
+      expect((await nativeImage.createFromPathAsync('does-not-exist.png')).isEmpty()).to.be.true();
+      expect((await nativeImage.createFromPathAsync(__filename)).isEmpty()).to.be.true();
+    });
+
+    it('createFromPathsAsync() decodes images in order', async () => {
+      const images = await nativeImage.createFromPathsAsync([imageLogo.path, 'does-not-exist.png', image3x3.path]);
+      expect(images.map(image => image.getSize())).to.deep.equal([
+        { width: imageLogo.width, height: imageLogo.height },
+        { width: 0, height: 0 },
+        { width: image3x3.width, height: image3x3.height }
+      ]);
+    });
+
+    it('createFromBufferAsync() and createFromDataURLAsync() decode images', async () => {
+      const fromBuffer = await nativeImage.createFromBufferAsync(nativeImage.createFromPath(imageLogo.path).toPNG());
+      expect(fromBuffer.getSize()).to.deep.equal({ width: imageLogo.width, height: imageLogo.height });
+
+      const fromDataURL = await nativeImage.createFromDataURLAsync(image2x2.dataUrl);
+      expect(fromDataURL.toDataURL()).to.equal(image2x2.dataUrl);
+    });
+
+    it('createFromBufferAsync() rejects non-buffers', async () => {
+      await expect(nativeImage.createFromBufferAsync('not a buffer' as any)).to.eventually.be.rejectedWith('buffer must be a node Buffer');
+    });
+
+    it('toPNGAsync() and toJPEGAsync() match the synchronous encoders', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path).resize({ width: 100 });
+      expect((await image.toPNGAsync()).equals(image.toPNG())).to.be.true();
+      expect((await image.toJPEGAsync(80)).equals(image.toJPEG(80))).to.be.true();
+    });
+
+    it('resizeAsync() returns a resized image', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      expect((await image.resizeAsync({ width: 269 })).getSize()).to.deep.equal({ width: 269, height: 95 });
+      expect((await image.resizeAsync({ width: -1, height: -1 })).isEmpty()).to.be.true();
+      expect((await nativeImage.createEmpty().resizeAsync({ width: 1, height: 1 })).isEmpty()).to.be.true();
+    });
+
+    it('resizeAllAsync() resizes images in order', async () => {
+      const images = await nativeImage.createFromPathsAsync([imageLogo.path, image3x3.path]);
+      const resized = await nativeImage.resizeAllAsync(images, { height: 2 });
+      expect(resized.map(image => image.getSize().height)).to.deep.equal([2, 2]);
+    });
+  });
+
   describe('crop(bounds)', () => {
     it('returns an empty image when called on an empty image', () => {
       expect(nativeImage.createEmpty().crop({ width: 1, height: 2, x: 0, y: 0 }).isEmpty()).to.be.true();
@@ -205,5 +205,31 @@ describe('process module', () => {
         expect(success).to.be.false();
       });
     });
+
+    describe('process.getStartupProfile()', () => {
+      it('returns the recorded startup phases', () => {
+        const profile = process.getStartupProfile();
+        expect(profile.timeOrigin).to.be.a('number').greaterThan(0);
+        expect(profile.phases).to.be.an('array').that.is.not.empty();
+        for (const phase of profile.phases) {
+          expect(phase.name).to.be.a('string');
+          expect(phase.startTime).to.be.a('number').at.least(0);
+          expect(phase.duration).to.be.a('number').at.least(0);
+        }
+      });
+
+      it('includes the browser main parts and app readiness', () => {
+        const names = process.getStartupProfile().phases.map(phase => phase.name);
+        expect(names).to.include.members([
+          'ElectronBrowserMainParts::PreEarlyInitialization',
+          'ElectronBrowserMainParts::PostEarlyInitialization',
+          'ElectronBrowserMainParts::PreMainMessageLoopRun',
+          'JavascriptEnvironment::JavascriptEnvironment',
+          'NodeBindings::CreateEnvironment',
+          'NodeBindings::LoadEnvironment',
+          'Browser::DidFinishLaunching'
+        ]);
+      });
+    });
   });
 });
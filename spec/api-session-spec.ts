@@ -5,11 +5,11 @@ import * as https from 'node:https';
 import * as path from 'node:path';
 import * as fs from 'node:fs';
 import * as ChildProcess from 'node:child_process';
-import { app, session, BrowserWindow, net, ipcMain, Session, webFrameMain, WebFrameMain } from 'electron/main';
+import { app, session, BrowserWindow, net, ipcMain, Session, webContents, webFrameMain, WebFrameMain } from 'electron/main';
 import * as send from 'send';
 import * as auth from 'basic-auth';
 import { closeAllWindows } from './lib/window-helpers';
-import { defer, listen } from './lib/spec-helpers';
+import { defer, listen, waitUntil } from './lib/spec-helpers';
 import { once } from 'node:events';
 import { setTimeout } from 'node:timers/promises';
 
@@ -540,6 +540,55 @@ describe('session module', () => {
         expect(proxy).to.equal(`PROXY myproxy:${proxyPort}`);
       }
     });
+
+    it('resolves many URLs concurrently', async () => {
+      server = http.createServer((req, res) => {
+        const pac = `
+          function FindProxyForURL(url, host) {
+            return "PROXY " + host + ":80";
+          }
+        `;
+        res.writeHead(200, {
+          'Content-Type': 'application/x-ns-proxy-autoconfig'
+        });
+        res.end(pac);
+      });
+      const { url } = await listen(server);
+      await customSession.setProxy({ mode: 'pac_script', pacScript: url });
+      const hosts = Array.from({ length: 100 }, (_, i) => `host${i % 50}.example.com`);
+      const proxies = await Promise.all(hosts.map(host => customSession.resolveProxy(`https://${host}/path`)));
+      expect(proxies).to.deep.equal(hosts.map(host => `PROXY ${host}:80`));
+    });
+
+    it('does not reuse results across proxy configurations', async () => {
+      await customSession.setProxy({ proxyRules: 'http=myproxy:80' });
+      expect(await customSession.resolveProxy('http://example.com/')).to.equal('PROXY myproxy:80');
+      await customSession.setProxy({ proxyRules: 'http=myproxy:81' });
+      expect(await customSession.resolveProxy('http://example.com/')).to.equal('PROXY myproxy:81');
+    });
+
+    it('does not wait for lookups that started before the proxy configuration changed', async () => {
+      // Hold the PAC script back so that the first lookup stays in flight.
+      let sendPac = () => {};
+      const pacRequested = new Promise<void>(resolve => {
+        server = http.createServer((req, res) => {
+          sendPac = () => {
+            res.writeHead(200, { 'Content-Type': 'application/x-ns-proxy-autoconfig' });
+            res.end('function FindProxyForURL(url, host) { return "PROXY myproxy:80"; }');
+          };
+          resolve();
+        });
+      });
+      const { url } = await listen(server);
+      await customSession.setProxy({ mode: 'pac_script', pacScript: url });
+      const first = customSession.resolveProxy('http://example.com/');
+      await pacRequested;
+
+      await customSession.setProxy({ proxyRules: 'http=myproxy:81' });
+      expect(await customSession.resolveProxy('http://example.com/')).to.equal('PROXY myproxy:81');
+      sendPac();
+      await first;
+    });
   });
 
   describe('ses.resolveHost(host)', () => {
@@ -770,6 +819,60 @@ describe('session module', () => {
       expect(numVerificationRequests).to.equal(1);
     });
 
+    it('accepts a cacheTTL option', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      let numVerificationRequests = 0;
+      ses.setCertificateVerifyProc((e, callback) => {
+        if (e.hostname !== '127.0.0.1') return callback(-3);
+        numVerificationRequests++;
+        callback(0);
+      }, { cacheTTL: 60000 });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      await w.loadURL(serverUrl);
+      expect(w.webContents.getTitle()).to.equal('hello');
+      // A fresh connection has its certificate verified again.
+      await ses.closeAllConnections();
+      await w.loadURL(serverUrl + '/test');
+      expect(numVerificationRequests).to.equal(1);
+      ses.clearCertificateVerifyProcCache();
+    });
+
+    it('calls the proc again after clearCertificateVerifyProcCache()', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      let numVerificationRequests = 0;
+      ses.setCertificateVerifyProc((e, callback) => {
+        if (e.hostname !== '127.0.0.1') return callback(-3);
+        numVerificationRequests++;
+        callback(0);
+      }, { cacheTTL: 60000 });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      await w.loadURL(serverUrl);
+      expect(numVerificationRequests).to.equal(1);
+      ses.clearCertificateVerifyProcCache();
+      await ses.closeAllConnections();
+      await w.loadURL(serverUrl + '/test');
+      expect(w.webContents.getTitle()).to.equal('hello');
+      expect(numVerificationRequests).to.equal(2);
+    });
+
+    it('throws when cacheTTL is negative', () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      expect(() => {
+        ses.setCertificateVerifyProc((e, callback) => callback(0), { cacheTTL: -1 });
+      }).to.throw(/cacheTTL must be a non-negative integer/);
+    });
+
+    it('throws when cacheTTL is not an integer', () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      for (const cacheTTL of [1.5, '1000', true] as any[]) {
+        expect(() => {
+          ses.setCertificateVerifyProc((e, callback) => callback(0), { cacheTTL });
+        }).to.throw(/cacheTTL must be a non-negative integer/);
+      }
+    });
+
     it('does not cancel requests in other sessions', async () => {
       const ses1 = session.fromPartition(`${Math.random()}`);
       ses1.setCertificateVerifyProc((opts, cb) => cb(0));
@@ -1583,6 +1686,101 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setWarmRendererPool(options)', () => {
+    afterEach(closeAllWindows);
+
+    const getRendererPids = () => app.getAppMetrics().filter(metric => metric.type === 'Tab').map(metric => metric.pid);
+
+    it('throws when size is invalid', () => {
+      const ses = session.fromPartition('' + Math.random());
+      expect(() => ses.setWarmRendererPool({ size: -1 })).to.throw('size must be a non-negative integer');
+    });
+
+    it('hands a pre-launched renderer to a compatible window', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      defer(() => ses.setWarmRendererPool({ size: 0 }));
+      const existing = new Set(getRendererPids());
+      ses.setWarmRendererPool({ size: 1, webPreferences: { sandbox: true } });
+      await waitUntil(() => getRendererPids().some(pid => !existing.has(pid)));
+      const warm = getRendererPids().filter(pid => !existing.has(pid));
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      expect(warm).to.include(w.webContents.getOSProcessId());
+    });
+
+    it('does not hand out a renderer launched with different switches', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      defer(() => ses.setWarmRendererPool({ size: 0 }));
+      const existing = new Set(getRendererPids());
+      ses.setWarmRendererPool({ size: 1, webPreferences: { sandbox: true } });
+      await waitUntil(() => getRendererPids().some(pid => !existing.has(pid)));
+      const warm = getRendererPids().filter(pid => !existing.has(pid));
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: false } });
+      await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      expect(warm).to.not.include(w.webContents.getOSProcessId());
+    });
+
+    it('keeps the spare usable after turning down an incompatible window', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      defer(() => ses.setWarmRendererPool({ size: 0 }));
+      const existing = new Set(getRendererPids());
+      ses.setWarmRendererPool({ size: 1, webPreferences: { sandbox: true } });
+      await waitUntil(() => getRendererPids().some(pid => !existing.has(pid)));
+      const warm = getRendererPids().filter(pid => !existing.has(pid));
+
+      const w1 = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: false } });
+      await w1.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      const w2 = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w2.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      expect(warm).to.include(w2.webContents.getOSProcessId());
+    });
+  });
+
+  describe('ses.setRendererProcessSharing(options)', () => {
+    afterEach(closeAllWindows);
+
+    const openWindows = async (ses: Session, count: number, webPreferences = {}) => {
+      const windows = [];
+      for (let i = 0; i < count; i++) {
+        const w = new BrowserWindow({ show: false, webPreferences: { session: ses, ...webPreferences } });
+        await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+        windows.push(w);
+      }
+      return windows.map(w => w.webContents.getOSProcessId());
+    };
+
+    it('throws when the options are invalid', () => {
+      const ses = session.fromPartition('' + Math.random());
+      expect(() => ses.setRendererProcessSharing({ maxProcesses: -1 })).to.throw('maxProcesses must be a non-negative integer');
+      expect(() => ses.setRendererProcessSharing({ maxProcesses: 1, windowsPerProcess: 0 })).to.throw('windowsPerProcess must be a positive integer');
+    });
+
+    it('caps the number of processes used by same-site windows', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      ses.setRendererProcessSharing({ maxProcesses: 2 });
+      const pids = await openWindows(ses, 4);
+      expect(new Set(pids).size).to.equal(2);
+    });
+
+    it('fills a process up to windowsPerProcess before starting another', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      ses.setRendererProcessSharing({ maxProcesses: 2, windowsPerProcess: 2 });
+      const pids = await openWindows(ses, 3);
+      expect(pids[1]).to.equal(pids[0]);
+      expect(pids[2]).to.not.equal(pids[0]);
+    });
+
+    it('does not share processes between windows with different switches', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      ses.setRendererProcessSharing({ maxProcesses: 1 });
+      const [sandboxed] = await openWindows(ses, 1, { sandbox: true });
+      const [unsandboxed] = await openWindows(ses, 1, { sandbox: false });
+      expect(sandboxed).to.not.equal(unsandboxed);
+    });
+  });
+
   describe('session-created event', () => {
     it('is emitted when a session is created', async () => {
       const sessionCreated = once(app, 'session-created') as Promise<[any, Session]>;
@@ -1622,6 +1820,83 @@ describe('session module', () => {
         session.defaultSession.setCodeCachePath(path.join(app.getPath('userData'), 'electron-test-code-cache'));
       }).to.not.throw();
     });
+
+    it('throws when a negative maxSize is provided', () => {
+      const cachePath = path.join(app.getPath('userData'), 'electron-test-code-cache');
+      expect(() => {
+        session.defaultSession.setCodeCachePath(cachePath, { maxSize: -1 });
+      }).to.throw('maxSize must be a non-negative number');
+      expect(() => {
+        session.defaultSession.setCodeCachePath(cachePath, { maxSize: 16 * 1024 * 1024 });
+      }).to.not.throw();
+    });
+  });
+
+  describe('code cache session options', () => {
+    it('throws when codeCachePath is not absolute', () => {
+      expect(() => {
+        session.fromPartition('persist:code-cache-relative', { codeCachePath: '../fixtures' });
+      }).to.throw('codeCachePath must be an absolute path');
+    });
+
+    it('throws when codeCacheMaxSize is negative', () => {
+      expect(() => {
+        session.fromPartition('persist:code-cache-negative', { codeCacheMaxSize: -1 });
+      }).to.throw('codeCacheMaxSize must be a non-negative number');
+    });
+
+    it('accepts a dedicated code cache location and size', () => {
+      const ses = session.fromPartition('persist:code-cache-dedicated', {
+        codeCachePath: path.join(app.getPath('userData'), 'electron-test-dedicated-code-cache'),
+        codeCacheMaxSize: 16 * 1024 * 1024
+      });
+      expect(ses).to.be.an.instanceOf(Session);
+    });
+  });
+
+  describe('ses.warmCodeCache()', () => {
+    let server: http.Server;
+    let serverUrl: string;
+    let requests: string[];
+
+    before(async () => {
+      server = http.createServer((req, res) => {
+        requests.push(req.url!);
+        if (req.url === '/bundle.js') {
+          res.setHeader('Content-Type', 'application/javascript');
+          res.end('function add (a, b) { return a + b; }');
+        } else {
+          res.setHeader('Content-Type', 'text/html');
+          res.end('<script src="/bundle.js"></script>');
+        }
+      });
+      serverUrl = (await listen(server)).url;
+    });
+
+    beforeEach(() => {
+      requests = [];
+    });
+
+    after(() => {
+      server.close();
+    });
+
+    it('loads every page in a hidden WebContents', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      const count = webContents.getAllWebContents().length;
+      await ses.warmCodeCache([`${serverUrl}/a.html`, `${serverUrl}/b.html`]);
+      expect(requests).to.include.members(['/a.html', '/b.html', '/bundle.js']);
+      expect(webContents.getAllWebContents()).to.have.lengthOf(count);
+    });
+
+    it('rejects when a page fails to load', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      await expect(ses.warmCodeCache(['bad-scheme://foo'])).to.eventually.be.rejected();
+    });
+
+    it('throws when urls is not an array of strings', async () => {
+      await expect((session.defaultSession.warmCodeCache as any)('foo')).to.eventually.be.rejectedWith('urls must be an array of strings');
+    });
   });
 
   describe('ses.setSSLConfig()', () => {
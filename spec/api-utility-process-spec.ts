@@ -2,7 +2,7 @@ import { expect } from 'chai';
 import * as childProcess from 'node:child_process';
 import * as path from 'node:path';
 import { BrowserWindow, MessageChannelMain, utilityProcess, app } from 'electron/main';
-import { ifit, startRemoteControlApp } from './lib/spec-helpers';
+import { ifit, startRemoteControlApp, waitUntil } from './lib/spec-helpers';
 import { closeWindow } from './lib/window-helpers';
 import { respondOnce, randomString, kOneKiloByte } from './lib/net-helpers';
 import { once } from 'node:events';
@@ -312,6 +312,135 @@ describe('utilityProcess module', () => {
     });
   });
 
+  describe('resource limits', () => {
+    it('throws for invalid limits', () => {
+      expect(() => {
+        utilityProcess.fork(path.join(fixturesPath, 'empty.js'), [], { maxRssMb: -1 });
+      }).to.throw('maxRssMb must be a positive integer.');
+      expect(() => {
+        utilityProcess.fork(path.join(fixturesPath, 'empty.js'), [], { maxOldGenerationSizeMb: 1.5 });
+      }).to.throw('maxOldGenerationSizeMb must be a positive integer.');
+    });
+
+    it('emits resource usage samples', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'endless.js'), [], {
+        resourceUsageInterval: 50
+      });
+      const [details] = await once(child, 'resource-usage');
+      expect(details.workingSetSize).to.be.greaterThan(0);
+      expect(details.percentCPUUsage).to.be.a('number');
+      const exit = once(child, 'exit');
+      child.kill();
+      await exit;
+    });
+
+    it('signals memory pressure and terminates the child at the limit', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'memory-hog.js'), [], {
+        maxRssMb: 256,
+        resourceUsageInterval: 20
+      });
+      const levels: string[] = [];
+      const childLevels: string[] = [];
+      child.on('memory-pressure', (level) => levels.push(level));
+      const moderate = new Promise<void>(resolve => {
+        child.on('message', (level) => {
+          childLevels.push(level);
+          if (level === 'moderate') resolve();
+        });
+      });
+      await moderate;
+      expect(levels).to.include('moderate');
+      const exit = once(child, 'exit');
+      child.postMessage('grow');
+      await exit;
+      expect(childLevels).to.include('moderate');
+    });
+  });
+
+  describe('createPool() API', () => {
+    const workerPath = path.join(fixturesPath, 'pool-worker.js');
+
+    it('throws for invalid sizes', () => {
+      expect(() => {
+        utilityProcess.createPool(workerPath, { minSize: -1 });
+      }).to.throw('minSize must be an integer greater than or equal to 0.');
+      expect(() => {
+        utilityProcess.createPool(workerPath, { minSize: 2, maxSize: 1 });
+      }).to.throw('maxSize must be an integer greater than or equal to 2.');
+      expect(() => {
+        utilityProcess.createPool(workerPath, { concurrency: 0 });
+      }).to.throw('concurrency must be an integer greater than or equal to 1.');
+    });
+
+    it('resolves jobs with the reply of the worker', async () => {
+      const pool = utilityProcess.createPool(workerPath, { minSize: 1, maxSize: 1 });
+      try {
+        const replies = await Promise.all([1, 2, 3].map(n => pool.run(n)));
+        expect(replies.map(reply => reply.result)).to.deep.equal([2, 4, 6]);
+        const metrics = pool.getMetrics();
+        expect(metrics.workers).to.equal(1);
+        expect(metrics.completedJobs).to.equal(3);
+        expect(metrics.queuedJobs).to.equal(0);
+        expect(metrics.averageRunTime).to.be.greaterThan(0);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('spreads jobs across workers up to maxSize', async () => {
+      const pool = utilityProcess.createPool(workerPath, { minSize: 0, maxSize: 2 });
+      try {
+        const replies = await Promise.all([1, 2].map(n => pool.run(n)));
+        expect(new Set(replies.map(reply => reply.pid)).size).to.equal(2);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('rejects the jobs of a worker that exits', async () => {
+      const pool = utilityProcess.createPool(workerPath, { minSize: 0, maxSize: 1 });
+      try {
+        await pool.run(1);
+        await expect(pool.run('exit')).to.eventually.be.rejected();
+        await waitUntil(() => pool.getMetrics().workers === 0);
+        const reply = await pool.run(2);
+        expect(reply.result).to.equal(4);
+        expect(pool.getMetrics().failedJobs).to.equal(1);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('does not hand new jobs to a worker whose reply port closed', async () => {
+      const pool = utilityProcess.createPool(workerPath, { minSize: 1, maxSize: 1 });
+      try {
+        const { pid } = await pool.run(1);
+        await expect(pool.run('exit')).to.eventually.be.rejected();
+        const reply = await pool.run(2);
+        expect(reply.result).to.equal(4);
+        expect(reply.pid).to.not.equal(pid);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('reaps idle workers beyond minSize', async () => {
+      const pool = utilityProcess.createPool(workerPath, { minSize: 0, maxSize: 2, idleTimeout: 10 });
+      try {
+        await Promise.all([1, 2].map(n => pool.run(n)));
+        await waitUntil(() => pool.getMetrics().workers === 0);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('rejects jobs after the pool has been closed', async () => {
+      const pool = utilityProcess.createPool(workerPath);
+      pool.close();
+      await expect(pool.run(1)).to.eventually.be.rejectedWith('The pool has been closed.');
+    });
+  });
+
   describe('behavior', () => {
     it('supports starting the v8 inspector with --inspect-brk', (done) => {
       const child = utilityProcess.fork(path.join(fixturesPath, 'log.js'), [], {
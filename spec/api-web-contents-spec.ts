@@ -189,6 +189,67 @@ describe('webContents module', () => {
     });
   });
 
+  describe('webContents.broadcast(targets, channel, args...)', () => {
+    afterEach(closeAllWindows);
+
+    const createListeningWindow = async (ses = session.defaultSession) => {
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`require('electron').ipcRenderer.on('state', (e, ...args) => {
+        require('electron').ipcRenderer.send('state-received', ...args);
+      }); null`);
+      return w;
+    };
+
+    const receive = (w: BrowserWindow) => once(w.webContents.ipc, 'state-received').then(([, ...args]) => args);
+
+    it('throws an error when the channel is missing', () => {
+      expect(() => {
+        (webContents.broadcast as any)([]);
+      }).to.throw('Missing required channel argument');
+    });
+
+    it('throws an error when the targets are neither an array nor a Session', () => {
+      expect(() => {
+        webContents.broadcast({} as any, 'state');
+      }).to.throw('targets must be an array or a Session');
+    });
+
+    it('sends the same message to every target', async () => {
+      const windows = await Promise.all([createListeningWindow(), createListeningWindow()]);
+      const received = windows.map(receive);
+      webContents.broadcast([windows[0].webContents, windows[1].webContents.mainFrame], 'state', { a: 1 }, 'b');
+      for (const args of await Promise.all(received)) {
+        expect(args).to.deep.equal([{ a: 1 }, 'b']);
+      }
+    });
+
+    it('sends large messages to every target', async () => {
+      const windows = await Promise.all([createListeningWindow(), createListeningWindow()]);
+      const received = windows.map(receive);
+      const state = { items: Array.from({ length: 10000 }, (_, i) => ({ id: i, name: `item ${i}` })) };
+      webContents.broadcast(windows.map(w => w.webContents), 'state', state);
+      for (const args of await Promise.all(received)) {
+        expect(args).to.deep.equal([state]);
+      }
+    });
+
+    it('sends to every WebContents of a session', async () => {
+      const ses = session.fromPartition(`broadcast-${Math.random()}`);
+      const [w1, w2] = await Promise.all([createListeningWindow(ses), createListeningWindow(ses)]);
+      const other = await createListeningWindow();
+      let otherReceived = false;
+      other.webContents.ipc.once('state-received', () => { otherReceived = true; });
+      const received = [w1, w2].map(receive);
+      webContents.broadcast(ses, 'state', 42);
+      for (const args of await Promise.all(received)) {
+        expect(args).to.deep.equal([42]);
+      }
+      await setTimeout(100);
+      expect(otherReceived).to.be.false();
+    });
+  });
+
   ifdescribe(features.isPrintingEnabled())('webContents.print()', () => {
     let w: BrowserWindow;
 
@@ -2242,6 +2303,129 @@ describe('webContents module', () => {
     });
   });
 
+  describe('setBackgroundThrottlingBudget()', () => {
+    afterEach(closeAllWindows);
+    it('reports no usage without a budget', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(w.webContents.getBackgroundThrottlingUsage()).to.be.null();
+      w.webContents.setBackgroundThrottlingBudget({ cpuTime: 10 });
+      expect(w.webContents.getBackgroundThrottlingUsage()).to.be.an('object');
+      w.webContents.setBackgroundThrottlingBudget(null);
+      expect(w.webContents.getBackgroundThrottlingUsage()).to.be.null();
+    });
+
+    it('validates the budget', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => w.webContents.setBackgroundThrottlingBudget({ cpuTime: -1 })).to.throw(/cpuTime must be a non-negative number/);
+      expect(() => w.webContents.setBackgroundThrottlingBudget({ cpuTime: 10, interval: 10 })).to.throw(/interval must be at least 100 milliseconds/);
+    });
+
+    it('keeps the current budget when the new one is invalid', () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.setBackgroundThrottlingBudget({ cpuTime: 10 });
+      expect(() => w.webContents.setBackgroundThrottlingBudget({ cpuTime: -1 })).to.throw(/cpuTime must be a non-negative number/);
+      expect(w.webContents.getBackgroundThrottlingUsage()).to.be.an('object');
+    });
+
+    it('freezes a hidden page that exceeds its budget', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setBackgroundThrottlingBudget({ cpuTime: 10, interval: 100 });
+      w.webContents.executeJavaScript('setInterval(() => { const end = Date.now() + 50; while (Date.now() < end); }, 0)');
+      await waitUntil(() => w.webContents.getBackgroundThrottlingUsage()!.throttled);
+      expect(w.webContents.getBackgroundThrottlingUsage()!.remainingBudget).to.be.below(0);
+    });
+
+    it('charges pages that share a process for their share of it', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { backgroundThrottling: false } });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      w.webContents.setWindowOpenHandler(() => ({
+        action: 'allow',
+        overrideBrowserWindowOptions: { show: false }
+      }));
+      const childCreated = once(w.webContents, 'did-create-window') as Promise<[BrowserWindow]>;
+      w.webContents.executeJavaScript('window.open("about:blank")', true);
+      const [child] = await childCreated;
+      expect(child.webContents.getOSProcessId()).to.equal(w.webContents.getOSProcessId());
+
+      child.webContents.setBackgroundThrottlingBudget({ cpuTime: 1000, interval: 1000 });
+      // Keeps the main thread of the shared renderer busy all the time.
+      w.webContents.executeJavaScript('setInterval(() => { const end = Date.now() + 50; while (Date.now() < end); }, 0)');
+      await waitUntil(() => child.webContents.getBackgroundThrottlingUsage()!.cpuTime > 0);
+      // The idle page pays for half of the process, not for all of it.
+      expect(child.webContents.getBackgroundThrottlingUsage()!.cpuTime).to.be.below(800);
+    });
+
+    it('does not charge a frozen page for a process it shares', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { backgroundThrottling: false } });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      w.webContents.setWindowOpenHandler(() => ({
+        action: 'allow',
+        overrideBrowserWindowOptions: { show: false }
+      }));
+      const childCreated = once(w.webContents, 'did-create-window') as Promise<[BrowserWindow]>;
+      w.webContents.executeJavaScript('window.open("about:blank")', true);
+      const [child] = await childCreated;
+
+      child.webContents.setBackgroundThrottlingBudget({ cpuTime: 100, interval: 200 });
+      w.webContents.executeJavaScript('setInterval(() => { const end = Date.now() + 50; while (Date.now() < end); }, 0)');
+      await waitUntil(() => child.webContents.getBackgroundThrottlingUsage()!.throttled);
+      // Only the opener keeps the process busy, so the child earns its budget
+      // back although the process never goes idle.
+      await waitUntil(() => !child.webContents.getBackgroundThrottlingUsage()!.throttled);
+    });
+  });
+
+  describe('freeze()', () => {
+    afterEach(closeAllWindows);
+    it('freezes a hidden page until it is shown', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(w.webContents.freeze()).to.equal(true);
+      expect(w.webContents.isFrozen()).to.equal(true);
+
+      const shown = once(w, 'show');
+      w.show();
+      await shown;
+      await waitUntil(() => !w.webContents.isFrozen());
+      expect(await w.webContents.executeJavaScript('document.visibilityState')).to.equal('visible');
+    });
+  });
+
+  describe('discard()', () => {
+    afterEach(closeAllWindows);
+    it('shuts down the renderer and reloads the page when it is shown', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      w.webContents.on('render-process-gone', () => {
+        expect.fail('render-process-gone should not be emitted');
+      });
+
+      const result = w.webContents.discard();
+      expect(result).to.be.an('object');
+      expect(result!.reclaimedMemory).to.be.above(0);
+      expect(w.webContents.isDiscarded()).to.equal(true);
+      expect(w.webContents.discard()).to.be.null();
+
+      const loaded = once(w.webContents, 'did-finish-load');
+      w.show();
+      await loaded;
+      expect(w.webContents.isDiscarded()).to.equal(false);
+      expect(await w.webContents.executeJavaScript('document.wasDiscarded')).to.equal(true);
+    });
+
+    it('is no longer discarded once the page is loaded again while hidden', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(w.webContents.discard()).to.be.an('object');
+      expect(w.webContents.isDiscarded()).to.equal(true);
+
+      await w.loadURL('about:blank');
+      expect(w.webContents.isDiscarded()).to.equal(false);
+      expect(w.webContents.freeze()).to.equal(true);
+    });
+  });
+
   ifdescribe(features.isPrintingEnabled())('getPrintersAsync()', () => {
     afterEach(closeAllWindows);
     it('can get printer list', async () => {
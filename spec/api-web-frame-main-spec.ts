@@ -250,6 +250,67 @@ describe('webFrameMain module', () => {
     });
   });
 
+  describe('WebFrame.executeScript', () => {
+    it('returns structured clones of the result', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const result = await w.webContents.mainFrame.executeScript('({ bytes: new Uint8Array([1, 2]), map: new Map([["a", 1]]) })');
+      expect(result.bytes).to.be.an.instanceOf(Uint8Array);
+      expect([...result.bytes]).to.deep.equal([1, 2]);
+      expect(result.map).to.be.an.instanceOf(Map);
+      expect(result.map.get('a')).to.equal(1);
+    });
+
+    it('waits for promises', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const webFrame = w.webContents.mainFrame;
+      expect(await webFrame.executeScript('new Promise(resolve => setTimeout(() => resolve(42), 10))')).to.equal(42);
+      await expect(webFrame.executeScript('Promise.reject(new TypeError("Wamp-wamp"))')).to.eventually.be.rejectedWith(/TypeError: Wamp-wamp/);
+    });
+
+    it('rejects when the script throws or the result cannot be cloned', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const webFrame = w.webContents.mainFrame;
+      await expect(webFrame.executeScript('console.log(test)')).to.eventually.be.rejectedWith(/ReferenceError/);
+      await expect(webFrame.executeScript('(')).to.eventually.be.rejectedWith(/SyntaxError/);
+      await expect(webFrame.executeScript('document')).to.eventually.be.rejected();
+    });
+
+    it('runs registered scripts in every frame', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame-with-frame-container.html'));
+      const script = webFrameMain.registerScript('window.counter = (window.counter || 0) + 1; [location.href, window.counter]');
+      expect(webFrameMain.registerScript('window.counter = (window.counter || 0) + 1; [location.href, window.counter]')).to.equal(script);
+
+      const frames = w.webContents.mainFrame.framesInSubtree;
+      for (let i = 1; i <= 2; i++) {
+        const results = await Promise.all(frames.map(frame => frame.executeScript(script)));
+        expect(results).to.deep.equal(frames.map(frame => [frame.url, i]));
+      }
+    });
+
+    it('forgets unregistered scripts', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const script = webFrameMain.registerScript('40 + 2');
+      expect(await w.webContents.mainFrame.executeScript(script)).to.equal(42);
+
+      webFrameMain.unregisterScript(script);
+      expect(() => w.webContents.mainFrame.executeScript(script)).to.throw(/Unknown script ID/);
+
+      const registeredAgain = webFrameMain.registerScript('40 + 2');
+      expect(registeredAgain).to.not.equal(script);
+      expect(await w.webContents.mainFrame.executeScript(registeredAgain)).to.equal(42);
+    });
+
+    it('throws for unknown script IDs', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => w.webContents.mainFrame.executeScript(0x7fffffff)).to.throw(/Unknown script ID/);
+    });
+  });
+
   describe('WebFrame.reload', () => {
     it('reloads a frame', async () => {
       const w = new BrowserWindow({ show: false });
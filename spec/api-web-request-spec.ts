@@ -291,6 +291,17 @@ describe('webRequest module', () => {
       expect(data).to.equal('/');
     });
 
+    it('exposes the request headers as a regular property', async () => {
+      ses.webRequest.onBeforeSendHeaders((details, callback) => {
+        expect(Object.keys(details)).to.include('requestHeaders');
+        details.requestHeaders.Accept = '*/*;test/header';
+        expect(details.requestHeaders).to.equal(details.requestHeaders);
+        callback({ requestHeaders: details.requestHeaders });
+      });
+      const { data } = await ajax(defaultURL);
+      expect(data).to.equal('/header/received');
+    });
+
     it('can change the request headers', async () => {
       ses.webRequest.onBeforeSendHeaders((details, callback) => {
         const requestHeaders = details.requestHeaders;
@@ -21,6 +21,16 @@ const features = process._linkedBinding('electron_common_features');
 const fixturesPath = path.resolve(__dirname, 'fixtures');
 const certPath = path.join(fixturesPath, 'certificates');
 
+// Only available when DCHECK_IS_ON.
+function isTestingBindingAvailable () {
+  try {
+    process._linkedBinding('electron_common_testing');
+    return true;
+  } catch {
+    return false;
+  }
+}
+
 describe('reporting api', () => {
   it('sends a report for an intervention', async () => {
     const reporting = new EventEmitter();
@@ -522,6 +532,59 @@ describe('command line switches', () => {
     });
   });
 
+  describe('--resource-cache-dir switch', () => {
+    const appPath = path.join(fixturesPath, 'api', 'resource-cache');
+    let rootDir: string;
+    let versionDir: string;
+
+    const runApp = async (...args: string[]) => {
+      appProcess = ChildProcess.spawn(process.execPath, [appPath, `--resource-cache-dir=${rootDir}`, ...args]);
+      let output = '';
+      appProcess.stdout.on('data', (data) => { output += data; });
+      const [code] = await once(appProcess, 'exit');
+      expect(code).to.equal(0);
+      return output;
+    };
+    const cacheFiles = () => fs.readdirSync(versionDir).filter(name => name.endsWith('.resources'));
+
+    beforeEach(() => {
+      rootDir = fs.mkdtempSync(path.join(app.getPath('temp'), 'electron-resource-cache-'));
+      versionDir = path.join(rootDir, process.versions.electron);
+    });
+
+    afterEach(() => {
+      fs.rmSync(rootDir, { force: true, recursive: true });
+    });
+
+    it('builds the cache in a directory of the Electron version', async () => {
+      await runApp();
+      const files = cacheFiles();
+      expect(files).to.have.lengthOf(1);
+      expect(fs.statSync(path.join(versionDir, files[0])).size).to.be.greaterThan(0);
+      if (process.platform !== 'win32') {
+        expect(fs.statSync(versionDir).mode & 0o777).to.equal(0o700);
+      }
+    });
+
+    it('rebuilds a damaged cache and deletes the caches of other builds', async () => {
+      await runApp();
+      const [file] = cacheFiles();
+      const size = fs.statSync(path.join(versionDir, file)).size;
+      fs.writeFileSync(path.join(versionDir, file), 'damaged');
+      fs.writeFileSync(path.join(versionDir, 'other-build.resources'), 'stale');
+
+      await runApp();
+      expect(cacheFiles()).to.deep.equal([file]);
+      expect(fs.statSync(path.join(versionDir, file)).size).to.equal(size);
+    });
+
+    ifit(isTestingBindingAvailable())('serves the resources of renderers from the cache', async () => {
+      const info = JSON.parse(await runApp('--report-renderer-usage'));
+      expect(info.resourceCount).to.be.greaterThan(0);
+      expect(info.loadCount).to.be.greaterThan(0);
+    });
+  });
+
   describe('--remote-debugging-port switch', () => {
     it('should display the discovery page', (done) => {
       const electronPath = process.execPath;
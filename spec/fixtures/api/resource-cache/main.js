@@ -0,0 +1,35 @@
+const { app, BrowserWindow } = require('electron');
+
+const fs = require('node:fs');
+const path = require('node:path');
+
+const versionDir = path.join(app.commandLine.getSwitchValue('resource-cache-dir'), process.versions.electron);
+
+// The cache is ready once it is the only file of its kind left.
+function isCacheReady () {
+  try {
+    return fs.readdirSync(versionDir).filter(name => name.endsWith('.resources')).length === 1;
+  } catch {
+    return false;
+  }
+}
+
+app.whenReady().then(async () => {
+  // Resources of sandboxed renderers come from the file the main process
+  // hands them.
+  const w = new BrowserWindow({ show: false, webPreferences: { sandbox: true } });
+  await w.loadURL('about:blank');
+  while (!isCacheReady()) {
+    await new Promise(resolve => setTimeout(resolve, 50));
+  }
+
+  if (process.argv.includes('--report-renderer-usage')) {
+    // A renderer launched once the cache is ready gets it right away. Styling
+    // SVG and MathML makes Blink load their stylesheets from the cache.
+    const renderer = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+    await renderer.loadURL('data:text/html,<svg><circle r="1"></circle></svg><math><mi>x</mi></math>');
+    const info = await renderer.webContents.executeJavaScript('process._linkedBinding(\'electron_common_testing\').getResourceCacheInfo()');
+    process.stdout.write(JSON.stringify(info));
+  }
+  app.quit();
+});
@@ -0,0 +1,21 @@
+const chunks = [];
+
+const grow = (size, interval) => setInterval(() => {
+  chunks.push(Buffer.alloc(size, 1));
+}, interval);
+
+// Grow slowly until the first warning, then wait to be told to go past the
+// limit so that the warning is seen on both sides before the process dies.
+let growing = grow(4 * 1024 * 1024, 20);
+
+process.parentPort.on('memory-pressure', ({ level }) => {
+  if (level === 'moderate' && growing) {
+    clearInterval(growing);
+    growing = null;
+  }
+  process.parentPort.postMessage(level);
+});
+
+process.parentPort.on('message', (e) => {
+  if (e.data === 'grow') grow(16 * 1024 * 1024, 20);
+});
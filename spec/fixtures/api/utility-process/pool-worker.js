@@ -0,0 +1,7 @@
+process.parentPort.on('message', (e) => {
+  const [reply] = e.ports;
+  if (e.data === 'exit') {
+    process.exit(1);
+  }
+  reply.postMessage({ pid: process.pid, result: e.data * 2 });
+});
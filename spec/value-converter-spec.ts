@@ -0,0 +1,68 @@
+import { expect } from 'chai';
+import { ifdescribe } from './lib/spec-helpers';
+
+function isTestingBindingAvailable () {
+  try {
+    process._linkedBinding('electron_common_testing');
+    return true;
+  } catch {
+    return false;
+  }
+}
+
+// These tests depend on functions that are only available when DCHECK_IS_ON.
+ifdescribe(isTestingBindingAvailable())('base::Value conversion', () => {
+  const roundTrip = (value: any) => process._linkedBinding('electron_common_testing').roundTripValue(value);
+
+  it('converts primitives, arrays and objects', () => {
+    expect(roundTrip({ a: 1, b: 'two', c: [true, null, 1.5], d: { e: {} } })).to.deep.equal({ a: 1, b: 'two', c: [true, null, 1.5], d: { e: {} } });
+  });
+
+  it('replaces cyclic references with null', () => {
+    const object: any = { name: 'root', children: [] };
+    object.self = object;
+    object.children.push(object);
+    expect(roundTrip(object)).to.deep.equal({ name: 'root', children: [null], self: null });
+  });
+
+  it('keeps objects that are referenced twice without a cycle', () => {
+    const shared = { value: 1 };
+    expect(roundTrip({ a: shared, b: shared })).to.deep.equal({ a: { value: 1 }, b: { value: 1 } });
+  });
+
+  it('turns array holes into null', () => {
+    // eslint-disable-next-line no-sparse-arrays
+    expect(roundTrip([1, , 3])).to.deep.equal([1, null, 3]);
+  });
+
+  it('leaves out values nested deeper than 100 levels', () => {
+    let object: any = {};
+    for (let i = 0; i < 150; i++) object = { next: object };
+    let depth = 0;
+    for (let value = roundTrip(object); value; value = value.next) depth++;
+    expect(depth).to.equal(100);
+  });
+
+  it('leaves out non-finite numbers from objects and nulls them in arrays', () => {
+    expect(roundTrip({ a: NaN, b: Infinity, c: -Infinity, d: 1 })).to.deep.equal({ d: 1 });
+    expect(roundTrip([NaN, Infinity, 1])).to.deep.equal([null, null, 1]);
+  });
+
+  it('leaves out undefined, functions and symbols', () => {
+    expect(roundTrip({ a: undefined, b: () => {}, c: Symbol('c'), d: 1 })).to.deep.equal({ d: 1 });
+  });
+
+  it('converts ArrayBuffers and views to binary', () => {
+    const bytes = new Uint8Array([1, 2, 3, 4]);
+    const cases: [ArrayBuffer | ArrayBufferView, number[]][] = [
+      [bytes.buffer, [1, 2, 3, 4]],
+      [bytes, [1, 2, 3, 4]],
+      [new DataView(bytes.buffer, 1, 2), [2, 3]]
+    ];
+    for (const [value, expected] of cases) {
+      const result = roundTrip(value);
+      expect(result).to.be.an.instanceOf(ArrayBuffer);
+      expect([...new Uint8Array(result)]).to.deep.equal(expected);
+    }
+  });
+});
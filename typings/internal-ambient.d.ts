@@ -126,6 +126,9 @@ declare namespace NodeJS {
     WebFrameMain: typeof Electron.WebFrameMain;
     fromId(processId: number, routingId: number): Electron.WebFrameMain;
     fromIdOrNull(processId: number, routingId: number): Electron.WebFrameMain | null;
+    registerScript(code: string): number;
+    unregisterScript(id: number): void;
+    _serializeMessage(args: any[]): Electron.SerializedMessage;
   }
 
   interface InternalWebPreferences {
@@ -146,6 +146,7 @@ declare namespace Electron {
     getItemCount(): number;
     popupAt(window: BaseWindow, x: number, y: number, positioning: number, sourceType: Required<Electron.PopupOptions>['sourceType'], callback: () => void): void;
     closePopupAt(id: number): void;
+    setLabel(index: number, label: string): void;
     setSublabel(index: number, label: string): void;
     setToolTip(index: number, tooltip: string): void;
     setIcon(index: number, image: string | NativeImage): void;
@@ -157,10 +158,15 @@ declare namespace Electron {
     insertSubMenu(index: number, commandId: number, label: string, submenu?: Menu): void;
     delegate?: any;
     _getAcceleratorTextAt(index: number): string;
+    _itemChangedAt(index: number): void;
+    getIndexOfCommandId(commandId: number): number;
+    getLabelAt(index: number): string;
+    getSublabelAt(index: number): string;
   }
 
   interface MenuItem {
     overrideReadOnlyProperty(property: string, value: any): void;
+    _setIcon(icon: NativeImage | string): void;
     groupId: number;
     getDefaultRoleAccelerator(): Accelerator | undefined;
     getCheckStatus(): boolean;